@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/compare.hpp>
+
+namespace ReflCpp::benchmarks {
+struct CompareKey {
+    uint32_t id = 7;
+    uint32_t group = 3;
+    uint64_t version = 11;
+
+    bool operator==(const CompareKey&) const = default;
+    auto operator<=>(const CompareKey&) const = default;
+};
+
+struct CompareRecord {
+    CompareKey key;
+    std::string name = "record";
+    double weight = 1.5;
+    uint16_t flags = 3;
+
+    bool operator==(const CompareRecord&) const = default;
+    auto operator<=>(const CompareRecord&) const = default;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::CompareKey)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::CompareKey)
+{
+    .name = "CompareKey",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::benchmarks::CompareKey::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::CompareKey::group, .name = "group" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::CompareKey::version, .name = "version" },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::CompareRecord)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::CompareRecord)
+{
+    .name = "CompareRecord",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::benchmarks::CompareRecord::key, .name = "key" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::CompareRecord::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::CompareRecord::weight, .name = "weight" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::CompareRecord::flags, .name = "flags" },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+// CompareKey is packed and compared with one memcmp, CompareRecord goes field by field
+TEST_CASE("Compare benchmarks", "[!benchmark][compare]") {
+    constexpr size_t Count = 1000;
+    std::vector<CompareKey> keys(Count);
+    std::vector<CompareRecord> records(Count);
+    // every other pair differs, so neither path can be skipped
+    for (size_t i = 0; i < Count; ++i) {
+        keys[i].version = i / 2;
+        records[i].key.version = i / 2;
+    }
+
+    BENCHMARK("CompareKey::operator== x1000") {
+        size_t equal = 0;
+        for (size_t i = 1; i < Count; ++i) {
+            equal += keys[i] == keys[i - 1];
+        }
+        return equal;
+    };
+
+    BENCHMARK("Equals(CompareKey) x1000") {
+        size_t equal = 0;
+        for (size_t i = 1; i < Count; ++i) {
+            equal += Equals(keys[i], keys[i - 1]).value();
+        }
+        return equal;
+    };
+
+    BENCHMARK("CompareRecord::operator== x1000") {
+        size_t equal = 0;
+        for (size_t i = 1; i < Count; ++i) {
+            equal += records[i] == records[i - 1];
+        }
+        return equal;
+    };
+
+    BENCHMARK("Equals(CompareRecord) x1000") {
+        size_t equal = 0;
+        for (size_t i = 1; i < Count; ++i) {
+            equal += Equals(records[i], records[i - 1]).value();
+        }
+        return equal;
+    };
+
+    BENCHMARK("CompareRecord::operator<=> x1000") {
+        size_t less = 0;
+        for (size_t i = 1; i < Count; ++i) {
+            less += records[i] < records[i - 1];
+        }
+        return less;
+    };
+
+    BENCHMARK("Compare(CompareRecord) x1000") {
+        size_t less = 0;
+        for (size_t i = 1; i < Count; ++i) {
+            less += Compare(records[i], records[i - 1]).value() < 0;
+        }
+        return less;
+    };
+}
+}
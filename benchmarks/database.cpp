@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+
+namespace ReflCpp::benchmarks {
+template <size_t N>
+struct Lookup {};
+}
+
+REFLCPP_REFLECT_TEMPLATE(size_t N)
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::Lookup<N>)
+REFLCPP_REFLECT_TEMPLATE(size_t N)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::Lookup<N>)
+{ .name = "Lookup" }
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+static constexpr size_t LookupTypeCount = 256;
+static constexpr size_t LookupsPerThread = 100'000;
+
+template <size_t... N>
+static std::vector<TypeID> RegisterLookupTypes(std::index_sequence<N...>) {
+    return { ReflectID<Lookup<N>>().value()... };
+}
+
+template <typename Func>
+static void RunOnThreads(const size_t count, const Func& func) {
+    std::vector<std::jthread> threads;
+    threads.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        threads.emplace_back(func, i);
+    }
+}
+
+static std::vector<size_t> ThreadCounts() {
+    std::vector<size_t> counts;
+    const size_t max = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t count = 1; count < max; count *= 2) {
+        counts.push_back(count);
+    }
+    counts.push_back(max);
+    return counts;
+}
+
+// every iteration starts its threads, which is small compared to the lookups each of them does,
+// so the time should stay flat as long as the lookups scale
+TEST_CASE("ReflectionDatabase benchmarks", "[!benchmark][database]") {
+    const std::vector<TypeID> ids = RegisterLookupTypes(std::make_index_sequence<LookupTypeCount>());
+    const auto& database = ReflectionDatabase::Instance();
+
+    for (const size_t thread_count : ThreadCounts()) {
+        BENCHMARK("GetType x" + std::to_string(thread_count) + " threads") {
+            RunOnThreads(thread_count, [&](const size_t thread) {
+                size_t found = 0;
+                for (size_t i = 0; i < LookupsPerThread; ++i) {
+                    found += database.GetType(ids[(i + thread) % ids.size()]).has_value();
+                }
+                CHECK(found == LookupsPerThread);
+            });
+        };
+
+        BENCHMARK("Reflect<T> x" + std::to_string(thread_count) + " threads") {
+            RunOnThreads(thread_count, [&](const size_t) {
+                size_t found = 0;
+                for (size_t i = 0; i < LookupsPerThread; ++i) {
+                    found += Reflect<Lookup<0>>().has_value();
+                }
+                CHECK(found == LookupsPerThread);
+            });
+        };
+    }
+}
+}
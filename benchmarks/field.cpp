@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <span>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/soa.hpp>
+
+namespace ReflCpp::benchmarks {
+struct Transform {
+    float x = 1.0f;
+    float y = 2.0f;
+    float z = 3.0f;
+    float scale = 1.0f;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::Transform)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::Transform)
+{
+    .name = "Transform",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{
+            .ptr = &ReflCpp::benchmarks::Transform::x,
+            .name = "x",
+        },
+        FieldData{
+            .ptr = &ReflCpp::benchmarks::Transform::y,
+            .name = "y",
+        },
+        FieldData{
+            .ptr = &ReflCpp::benchmarks::Transform::z,
+            .name = "z",
+        },
+        FieldData{
+            .ptr = &ReflCpp::benchmarks::Transform::scale,
+            .name = "scale",
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+TEST_CASE("Field access benchmarks", "[!benchmark][field]") {
+    constexpr size_t Count = 1000;
+    std::vector<Transform> transforms(Count);
+    const Field& field = Reflect<Transform>().value().GetField("y")->get();
+
+    std::vector<Variant> instances;
+    instances.reserve(Count);
+    for (auto& transform : transforms) {
+        instances.push_back(Variant::Create<Transform&>(transform).value());
+    }
+
+    BENCHMARK("Field::GetValue<float>() x1000") {
+        float sum = 0.0f;
+        for (const auto& instance : instances) {
+            sum += field.GetValue<float>(instance).value();
+        }
+        return sum;
+    };
+
+    BENCHMARK("Field::GetRef<float>() x1000") {
+        float sum = 0.0f;
+        for (const auto& instance : instances) {
+            sum += field.GetRef<float>(instance).value();
+        }
+        return sum;
+    };
+
+    const FieldAccessor<float> accessor = field.Accessor<float>().value();
+    BENCHMARK("FieldAccessor<float>::Get() x1000") {
+        float sum = 0.0f;
+        for (const auto& transform : transforms) {
+            sum += accessor.Get(&transform);
+        }
+        return sum;
+    };
+
+    BENCHMARK("FieldAccessor<float>::Ref() += x1000") {
+        for (auto& transform : transforms) {
+            accessor.Ref(&transform) += 1.0f;
+        }
+        return transforms.front().y;
+    };
+
+    BENCHMARK("Transform::y direct x1000") {
+        float sum = 0.0f;
+        for (const auto& transform : transforms) {
+            sum += transform.y;
+        }
+        return sum;
+    };
+}
+}
+
+namespace ReflCpp::benchmarks {
+TEST_CASE("Field column benchmarks", "[!benchmark][field]") {
+    constexpr size_t Count = 100'000;
+    std::vector<Transform> transforms(Count);
+    std::vector<float> column(Count);
+    const Field& field = Reflect<Transform>().value().GetField("y")->get();
+
+    std::vector<Variant> instances;
+    instances.reserve(Count);
+    for (auto& transform : transforms) {
+        instances.push_back(Variant::Create<Transform&>(transform).value());
+    }
+
+    BENCHMARK("Field::GetValue<float>() x100k") {
+        for (size_t i = 0; i < Count; ++i) {
+            column[i] = field.GetValue<float>(instances[i]).value();
+        }
+        return column.back();
+    };
+
+    BENCHMARK("Field::Gather(span<Transform>, span<float>) x100k") {
+        (void)field.Gather(std::span(transforms), std::span(column));
+        return column.back();
+    };
+
+    BENCHMARK("Field::Scatter(span<float>, span<Transform>) x100k") {
+        (void)field.Scatter(std::span(column), std::span(transforms));
+        return transforms.back().y;
+    };
+
+    BENCHMARK("Transform::y direct copy x100k") {
+        for (size_t i = 0; i < Count; ++i) {
+            column[i] = transforms[i].y;
+        }
+        return column.back();
+    };
+}
+}
+
+namespace ReflCpp::benchmarks {
+TEST_CASE("Struct of arrays benchmarks", "[!benchmark][field]") {
+    constexpr size_t Count = 100'000;
+    std::vector<Transform> transforms(Count);
+    auto soa = ToSoA(transforms).value();
+
+    BENCHMARK("ToSoA(vector<Transform>) x100k") {
+        return ToSoA(transforms).value().Size();
+    };
+
+    BENCHMARK("StructOfArrays<Transform>::CopyTo() x100k") {
+        return soa.CopyTo(transforms);
+    };
+}
+}
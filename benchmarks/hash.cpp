@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/hash.hpp>
+
+namespace ReflCpp::benchmarks {
+struct HashPoint {
+    float x = 1.0f;
+    float y = 2.0f;
+    float z = 3.0f;
+    float w = 4.0f;
+};
+
+struct HashRecord {
+    uint32_t id = 7;
+    std::string name = "record";
+    HashPoint position;
+    uint16_t flags = 3;
+};
+}
+
+template <>
+struct std::hash<ReflCpp::benchmarks::HashPoint> {
+    size_t operator()(const ReflCpp::benchmarks::HashPoint& point) const noexcept {
+        size_t hash = std::hash<float>{}(point.x);
+        for (const float value : { point.y, point.z, point.w }) {
+            hash ^= std::hash<float>{}(value) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
+
+template <>
+struct std::hash<ReflCpp::benchmarks::HashRecord> {
+    size_t operator()(const ReflCpp::benchmarks::HashRecord& record) const noexcept {
+        size_t hash = std::hash<uint32_t>{}(record.id);
+        for (const size_t value : {
+                 std::hash<std::string>{}(record.name),
+                 std::hash<ReflCpp::benchmarks::HashPoint>{}(record.position),
+                 std::hash<uint16_t>{}(record.flags),
+             }) {
+            hash ^= value + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::HashPoint)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::HashPoint)
+{
+    .name = "HashPoint",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashPoint::x, .name = "x" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashPoint::y, .name = "y" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashPoint::z, .name = "z" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashPoint::w, .name = "w" },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::HashRecord)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::HashRecord)
+{
+    .name = "HashRecord",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashRecord::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashRecord::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashRecord::position, .name = "position" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::HashRecord::flags, .name = "flags" },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+// HashPoint has no padding and is hashed as one block, HashRecord goes field by field
+TEST_CASE("Hash benchmarks", "[!benchmark][hash]") {
+    constexpr size_t Count = 1000;
+    const std::vector<HashPoint> points(Count);
+    const std::vector<HashRecord> records(Count);
+
+    BENCHMARK("std::hash<HashPoint> x1000") {
+        size_t hash = 0;
+        for (const auto& point : points) {
+            hash ^= std::hash<HashPoint>{}(point);
+        }
+        return hash;
+    };
+
+    BENCHMARK("Hash(HashPoint) x1000") {
+        uint64_t hash = 0;
+        for (const auto& point : points) {
+            hash ^= Hash(point).value();
+        }
+        return hash;
+    };
+
+    BENCHMARK("std::hash<HashRecord> x1000") {
+        size_t hash = 0;
+        for (const auto& record : records) {
+            hash ^= std::hash<HashRecord>{}(record);
+        }
+        return hash;
+    };
+
+    BENCHMARK("Hash(HashRecord) x1000") {
+        uint64_t hash = 0;
+        for (const auto& record : records) {
+            hash ^= Hash(record).value();
+        }
+        return hash;
+    };
+
+    std::vector<Variant> variants;
+    for (const auto& record : records) {
+        variants.push_back(Variant::Create<const HashRecord&>(record).value());
+    }
+    BENCHMARK("Hash(Variant of HashRecord) x1000") {
+        uint64_t hash = 0;
+        for (const auto& variant : variants) {
+            hash ^= Hash(variant).value();
+        }
+        return hash;
+    };
+}
+}
@@ -0,0 +1,28 @@
+#include "allocation_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local size_t allocations = 0;
+}
+
+size_t ReflCpp::benchmarks::AllocationCounter::Count() noexcept {
+    return allocations;
+}
+
+void* operator new(const std::size_t size) {
+    ++allocations;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
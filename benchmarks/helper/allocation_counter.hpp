@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ReflCpp::benchmarks {
+/// Counts the heap allocations made on the current thread,
+/// by replacing the global 'operator new'.
+struct AllocationCounter {
+    [[nodiscard]]
+    static size_t Count() noexcept;
+};
+
+/// Counts the heap allocations made on the current thread during its lifetime.
+struct AllocationScope {
+private:
+    size_t start_;
+
+public:
+    AllocationScope() noexcept
+        : start_(AllocationCounter::Count()) {}
+
+    [[nodiscard]]
+    size_t Allocations() const noexcept {
+        return AllocationCounter::Count() - start_;
+    }
+};
+}
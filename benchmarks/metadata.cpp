@@ -0,0 +1,101 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+
+#include "helper/allocation_counter.hpp"
+
+namespace ReflCpp::benchmarks {
+template <size_t N>
+struct Metadata {
+    int32_t a = 0;
+    float b = 0.0f;
+    double c = 0.0;
+    uint64_t d = 0;
+    int32_t e = 0;
+    float f = 0.0f;
+    double g = 0.0;
+    uint64_t h = 0;
+
+    [[nodiscard]]
+    int32_t Get() const {
+        return a;
+    }
+
+    void Set(const int32_t value) {
+        a = value;
+    }
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE(size_t N)
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::Metadata<N>)
+REFLCPP_REFLECT_TEMPLATE(size_t N)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::Metadata<N>)
+{
+    .name = "Metadata",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::a, .name = "a" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::b, .name = "b" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::c, .name = "c" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::d, .name = "d" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::e, .name = "e" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::f, .name = "f" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::g, .name = "g" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::h, .name = "h" },
+    },
+    .methods = {
+        MethodData{
+            .name = "Get",
+            .funcs = { MethodFuncData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::Get } },
+        },
+        MethodData{
+            .name = "Set",
+            .funcs = { MethodFuncData{ .ptr = &ReflCpp::benchmarks::Metadata<N>::Set, .args = { "value" } } },
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+static constexpr size_t MetadataTypeCount = 64;
+
+template <size_t... N>
+static std::vector<const Type*> RegisterMetadataTypes(std::index_sequence<N...>) {
+    return { &Reflect<Metadata<N>>().value()... };
+}
+
+// walks every field and function, which is what serializers and editors do over and over
+TEST_CASE("Metadata benchmarks", "[!benchmark][database]") {
+    // the field types are shared by every type, so they are not counted
+    (void)Reflect<Metadata<MetadataTypeCount>>().value();
+
+    const AllocationScope scope;
+    const std::vector<const Type*> types = RegisterMetadataTypes(std::make_index_sequence<MetadataTypeCount>());
+    WARN("registering " << MetadataTypeCount << " types with 8 fields and 2 methods took "
+         << scope.Allocations() << " allocations");
+
+    const auto stats = ReflectionDatabase::Instance().GetMetadataStats();
+    WARN("metadata arena: " << stats.used << " bytes used of " << stats.reserved << " in " << stats.blocks << " blocks");
+
+    BENCHMARK("enumerate fields and methods of 64 types") {
+        size_t sum = 0;
+        for (const Type* type : types) {
+            for (const Field& field : type->GetFields()) {
+                sum += field.GetType().value().Value();
+            }
+            for (const Method& method : type->GetMethods()) {
+                for (const auto& func : method.GetFunctions()) {
+                    sum += func->IsStatic();
+                }
+            }
+        }
+        return sum;
+    };
+}
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/thread_pool.hpp>
+
+namespace ReflCpp::benchmarks {
+struct Particle {
+    float position[3]{};
+    float velocity[3]{ 1.0f, 0.5f, 0.25f };
+
+    void Update(const float dt) {
+        for (size_t i = 0; i < 3; ++i) {
+            velocity[i] -= velocity[i] * 0.01f * dt;
+            position[i] += std::sin(velocity[i]) * dt;
+        }
+    }
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::Particle)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::Particle)
+{
+    .name = "Particle",
+    ._namespace = "ReflCpp::benchmarks",
+    .methods = {
+        MethodData{
+            .name = "Update",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &ReflCpp::benchmarks::Particle::Update,
+                    .args = { "dt" },
+                },
+            },
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+static constexpr size_t ParticleCount = 200'000;
+
+static std::vector<size_t> PoolSizes() {
+    std::vector<size_t> sizes;
+    const size_t max = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t size = 1; size < max; size *= 2) {
+        sizes.push_back(size);
+    }
+    sizes.push_back(max);
+    return sizes;
+}
+
+// the time per iteration should drop with every doubling of threads, as long as there are cores for them
+TEST_CASE("Parallel invoke benchmarks", "[!benchmark][method]") {
+    std::vector<Particle> particles(ParticleCount);
+    const Method& update = Reflect<Particle>().value().GetMethod("Update")->get();
+    const ArgumentPack args{ Variant::Create<float>(0.016f).value() };
+
+    BENCHMARK("Method::InvokeBatch(span<Particle>, float)") {
+        return update.InvokeBatch(std::span(particles), args);
+    };
+
+    for (const size_t pool_size : PoolSizes()) {
+        ThreadPool pool({ .threads = pool_size, .chunkSize = 1024 });
+        BENCHMARK("Method::InvokeParallel(span<Particle>, float) x" + std::to_string(pool_size) + " threads") {
+            return update.InvokeParallel(pool, std::span(particles), args);
+        };
+    }
+}
+}
@@ -0,0 +1,187 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/binary.hpp>
+#include <refl-cpp/json.hpp>
+#include <refl-cpp/flat.hpp>
+
+namespace ReflCpp::benchmarks {
+struct Point {
+    float x = 1.0f;
+    float y = 2.0f;
+    float z = 3.0f;
+    float w = 4.0f;
+};
+
+struct Entity {
+    uint32_t id = 7;
+    Point position;
+    uint16_t flags = 3;
+    std::string name = "entity";
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::Point)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::Point)
+{
+    .name = "Point",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::benchmarks::Point::x, .name = "x" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Point::y, .name = "y" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Point::z, .name = "z" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Point::w, .name = "w" },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::Entity)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::Entity)
+{
+    .name = "Entity",
+    ._namespace = "ReflCpp::benchmarks",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::benchmarks::Entity::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Entity::position, .name = "position" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Entity::flags, .name = "flags" },
+        FieldData{ .ptr = &ReflCpp::benchmarks::Entity::name, .name = "name" },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+TEST_CASE("Binary serializer benchmarks", "[!benchmark][binary]") {
+    constexpr size_t Count = 1000;
+    const std::vector<Point> points(Count);
+    const std::vector<Entity> entities(Count);
+    std::vector<std::byte> buffer;
+    buffer.reserve(Count * 64);
+
+    BENCHMARK("SerializeBinary(Point) x1000") {
+        buffer.clear();
+        for (const auto& point : points) {
+            (void)SerializeBinary(point, buffer);
+        }
+        return buffer.size();
+    };
+
+    BENCHMARK("SerializeBinary(Entity) x1000") {
+        buffer.clear();
+        for (const auto& entity : entities) {
+            (void)SerializeBinary(entity, buffer);
+        }
+        return buffer.size();
+    };
+
+    BENCHMARK("hand written Entity x1000") {
+        buffer.clear();
+        for (const auto& entity : entities) {
+            const auto append = [&](const void* data, const size_t size) {
+                const auto* bytes = static_cast<const std::byte*>(data);
+                buffer.insert(buffer.end(), bytes, bytes + size);
+            };
+            const uint64_t length = 4 + sizeof(Point) + 2 + 8 + entity.name.size();
+            const uint64_t name_length = entity.name.size();
+            append(&length, sizeof(length));
+            append(&entity.id, sizeof(entity.id));
+            append(&entity.position, sizeof(entity.position));
+            append(&entity.flags, sizeof(entity.flags));
+            append(&name_length, sizeof(name_length));
+            append(entity.name.data(), entity.name.size());
+        }
+        return buffer.size();
+    };
+
+    buffer.clear();
+    for (const auto& entity : entities) {
+        (void)SerializeBinary(entity, buffer);
+    }
+    std::vector<Entity> read(Count);
+    BENCHMARK("DeserializeBinary(Entity) x1000") {
+        std::span<const std::byte> in = buffer;
+        for (auto& entity : read) {
+            in = in.subspan(DeserializeBinary(in, entity).value());
+        }
+        return read.back().id;
+    };
+}
+}
+
+namespace ReflCpp::benchmarks {
+TEST_CASE("JSON benchmarks", "[!benchmark][json]") {
+    constexpr size_t Count = 1000;
+    const std::vector<Entity> entities(Count);
+    std::ostringstream stream;
+
+    BENCHMARK("WriteJson(Entity) x1000") {
+        stream.str({});
+        for (const auto& entity : entities) {
+            (void)WriteJson(entity, stream);
+            stream << '\n';
+        }
+        return stream.tellp();
+    };
+
+    stream.str({});
+    for (const auto& entity : entities) {
+        (void)WriteJson(entity, stream);
+        stream << '\n';
+    }
+    const std::string lines = stream.str();
+    std::vector<Entity> read(Count);
+    BENCHMARK("ReadJson(Entity) x1000") {
+        std::string_view in = lines;
+        for (auto& entity : read) {
+            in.remove_prefix(ReadJson(in, entity).value());
+        }
+        return read.back().id;
+    };
+}
+}
+
+namespace ReflCpp::benchmarks {
+// opening the mapping costs the same for any count, reading with 'DeserializeBinary' grows with it
+TEST_CASE("Flat format benchmarks", "[!benchmark][flat]") {
+    constexpr size_t Count = 100'000;
+    const std::vector<Point> points(Count);
+
+    const auto path = std::filesystem::temp_directory_path() / "refl-cpp_flat_benchmark.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        (void)WriteFlat(std::span(points), out);
+    }
+    const std::string path_string = path.string();
+
+    BENCHMARK("FlatFile<Point>::Open x100000") {
+        const auto file = FlatFile<Point>::Open(path_string.c_str()).value();
+        return file.Objects().back().w;
+    };
+
+    std::vector<std::byte> buffer;
+    for (const auto& point : points) {
+        (void)SerializeBinary(point, buffer);
+    }
+    std::vector<Point> read(Count);
+    BENCHMARK("DeserializeBinary(Point) x100000") {
+        std::span<const std::byte> in = buffer;
+        for (auto& point : read) {
+            in = in.subspan(DeserializeBinary(in, point).value());
+        }
+        return read.back().w;
+    };
+
+    std::filesystem::remove(path);
+}
+}
@@ -0,0 +1,283 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "helper/allocation_counter.hpp"
+
+namespace ReflCpp::benchmarks {
+struct Counter {
+    int value = 0;
+
+    void Add(const int amount) {
+        value += amount;
+    }
+
+    [[nodiscard]]
+    int Get() const {
+        return value;
+    }
+
+    void AddAll(const int a, const int b, const int c, const int d) {
+        value += a + b + c + d;
+    }
+
+    void Set(const float amount) {
+        value = static_cast<int>(amount);
+    }
+
+    void Set(const double amount) {
+        value = static_cast<int>(amount);
+    }
+
+    void Set(const int amount) {
+        value = amount;
+    }
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::benchmarks::Counter)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::benchmarks::Counter)
+{
+    .name = "Counter",
+    ._namespace = "ReflCpp::benchmarks",
+    .methods = {
+        MethodData{
+            .name = "Add",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &ReflCpp::benchmarks::Counter::Add,
+                    .args = { "amount" },
+                },
+            },
+        },
+        MethodData{
+            .name = "Get",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &ReflCpp::benchmarks::Counter::Get,
+                },
+            },
+        },
+        MethodData{
+            .name = "AddAll",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &ReflCpp::benchmarks::Counter::AddAll,
+                    .args = { "a", "b", "c", "d" },
+                },
+            },
+        },
+        MethodData{
+            .name = "Set",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = static_cast<void (ReflCpp::benchmarks::Counter::*)(float)>(&ReflCpp::benchmarks::Counter::Set),
+                    .args = { "amount" },
+                },
+                MethodFuncData{
+                    .ptr = static_cast<void (ReflCpp::benchmarks::Counter::*)(double)>(&ReflCpp::benchmarks::Counter::Set),
+                    .args = { "amount" },
+                },
+                MethodFuncData{
+                    .ptr = static_cast<void (ReflCpp::benchmarks::Counter::*)(int)>(&ReflCpp::benchmarks::Counter::Set),
+                    .args = { "amount" },
+                },
+            },
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::benchmarks {
+TEST_CASE("Variant allocations", "[variant]") {
+    Counter counter;
+    int value = 42;
+    const Type& type = Reflect<Counter>().value();
+    const Method& add = type.GetMethod("Add")->get();
+    const Method& get = type.GetMethod("Get")->get();
+
+    // make sure all involved types are registered up front
+    const Variant instance = Variant::Create<Counter&>(counter).value();
+    const ArgumentList args{ Variant::Create<int>(1).value() };
+    (void)add.Invoke(instance, args).value();
+    (void)get.Invoke(instance, {}).value();
+    (void)ReflectID<int&>().value();
+    (void)ReflectID<int*>().value();
+
+    SECTION("scalar values") {
+        const AllocationScope scope;
+        const auto variant = Variant::Create<int>(value).value();
+        CHECK(scope.Allocations() == 0);
+    }
+
+    SECTION("references and pointers") {
+        const AllocationScope scope;
+        const auto ref = Variant::Create<int&>(value).value();
+        const auto ptr = Variant::Create<int*>(&value).value();
+        CHECK(scope.Allocations() == 0);
+    }
+
+    SECTION("Method::Invoke with scalar arguments") {
+        const AllocationScope scope;
+        (void)add.Invoke(instance, args).value();
+        CHECK(scope.Allocations() == 0);
+    }
+
+    SECTION("Method::Invoke with an argument pack") {
+        const AllocationScope scope;
+        const ArgumentPack pack{ Variant::Create<int>(1).value() };
+        (void)add.Invoke(instance, pack).value();
+        CHECK(scope.Allocations() == 0);
+    }
+
+    SECTION("Method::Invoke with a braced argument list") {
+        const AllocationScope scope;
+        (void)add.Invoke(instance, { Variant::Create<int>(1).value() }).value();
+        CHECK(scope.Allocations() == 0);
+    }
+
+    SECTION("Method::Invoke with native arguments") {
+        const AllocationScope scope;
+        (void)add.Invoke(counter, 1).value();
+        (void)add.Invoke(counter, value).value();
+        CHECK(scope.Allocations() == 0);
+    }
+
+    SECTION("Method::Invoke with scalar return value") {
+        const AllocationScope scope;
+        (void)get.Invoke(instance, {}).value();
+        CHECK(scope.Allocations() == 0);
+    }
+
+    SECTION("Method::InvokeInto a reused slot") {
+        Variant slot = Variant::Create<int>(0).value();
+        int out = 0;
+        const AllocationScope scope;
+        (void)get.InvokeInto(instance, {}, slot).value();
+        (void)get.InvokeInto(instance, {}, out).value();
+        CHECK(scope.Allocations() == 0);
+    }
+}
+
+TEST_CASE("Variant benchmarks", "[!benchmark][variant]") {
+    Counter counter;
+    int value = 42;
+    std::string text = "not trivially copyable";
+    const Type& type = Reflect<Counter>().value();
+    const Method& add = type.GetMethod("Add")->get();
+
+    const Variant instance = Variant::Create<Counter&>(counter).value();
+    const ArgumentList args{ Variant::Create<int>(1).value() };
+
+    BENCHMARK("Variant::Create<int>") {
+        return Variant::Create<int>(value);
+    };
+
+    BENCHMARK("Variant::Create<int&>") {
+        return Variant::Create<int&>(value);
+    };
+
+    BENCHMARK("Variant::Create<std::string> (heap)") {
+        return Variant::Create<std::string>(text);
+    };
+
+    const Variant intVariant = Variant::Create<int>(value).value();
+    BENCHMARK("Variant::CanGet<int>") {
+        return intVariant.CanGet<int>();
+    };
+
+    BENCHMARK("Variant::Get<const int&>") {
+        return intVariant.Get<const int&>().value();
+    };
+
+    const Method& get = type.GetMethod("Get")->get();
+    BENCHMARK("Method::Invoke()") {
+        return get.Invoke(instance, {});
+    };
+
+    Variant slot = Variant::Create<int>(0).value();
+    BENCHMARK("Method::InvokeInto() reused slot") {
+        return get.InvokeInto(instance, {}, slot);
+    };
+
+    int out = 0;
+    BENCHMARK("Method::InvokeInto() int&") {
+        return get.InvokeInto(instance, {}, out);
+    };
+
+    BENCHMARK("Method::Invoke(int)") {
+        return add.Invoke(instance, args);
+    };
+
+    BENCHMARK("Method::Invoke(Counter&, int) native") {
+        return add.Invoke(counter, 1);
+    };
+
+    const Method& addAll = type.GetMethod("AddAll")->get();
+    const ArgumentList fourArgs{
+        Variant::Create<int>(1).value(),
+        Variant::Create<int>(2).value(),
+        Variant::Create<int>(3).value(),
+        Variant::Create<int>(4).value(),
+    };
+    BENCHMARK("Method::Invoke(int, int, int, int)") {
+        return addAll.Invoke(instance, fourArgs);
+    };
+
+    BENCHMARK("Method::Invoke(Counter&, int, int, int, int) native") {
+        return addAll.Invoke(counter, 1, 2, 3, 4);
+    };
+
+    // resolves to the last of three overloads, which the overload cache skips to
+    const Method& set = type.GetMethod("Set")->get();
+    BENCHMARK("Method::Invoke(int) overloaded") {
+        return set.Invoke(instance, args);
+    };
+
+    const PreparedCall preparedSet = set.Prepare<int>().value();
+    BENCHMARK("PreparedCall::Invoke(int) overloaded") {
+        return preparedSet.Invoke(instance, args);
+    };
+
+    const auto addDelegate = add.As<void(Counter&, int)>().value();
+    BENCHMARK("Delegate(Counter&, int)") {
+        addDelegate(counter, 1);
+        return counter.value;
+    };
+
+    BENCHMARK("Counter::Add(int) direct") {
+        counter.Add(1);
+        return counter.value;
+    };
+}
+TEST_CASE("Batch invoke benchmarks", "[!benchmark][method]") {
+    constexpr size_t Count = 1000;
+    std::vector<Counter> counters(Count);
+    const Type& type = Reflect<Counter>().value();
+    const Method& add = type.GetMethod("Add")->get();
+    const ArgumentPack args{ Variant::Create<int>(1).value() };
+
+    std::vector<Variant> instances;
+    instances.reserve(Count);
+    for (auto& counter : counters) {
+        instances.push_back(Variant::Create<Counter&>(counter).value());
+    }
+
+    BENCHMARK("Method::Invoke(int) x1000") {
+        for (const auto& instance : instances) {
+            (void)add.Invoke(instance, args);
+        }
+        return counters.front().value;
+    };
+
+    BENCHMARK("Method::InvokeBatch(span<Counter>, int) x1000") {
+        (void)add.InvokeBatch(std::span(counters), args);
+        return counters.front().value;
+    };
+
+    BENCHMARK("Method::InvokeBatch(span<Variant>, int) x1000") {
+        (void)add.InvokeBatch(instances, args);
+        return counters.front().value;
+    };
+}
+}
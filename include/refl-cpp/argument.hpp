@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "refl-cpp/type_id.hpp"
@@ -12,5 +13,9 @@ struct ArgumentInfo {
     const TypeID type;
 };
 
+/// Owning list of arguments.
 using ArgumentList = std::vector<Variant>;
+
+/// What invoking takes, so arguments can live anywhere, like an 'ArgumentList' or an 'ArgumentPack'.
+using ArgumentSpan = std::span<const Variant>;
 }
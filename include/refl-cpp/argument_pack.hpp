@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "refl-cpp/variant.hpp"
+#include "refl-cpp/argument.hpp"
+
+namespace ReflCpp {
+/// Arguments stored in place with a fixed capacity,
+/// so building them for a call does not allocate.
+template <size_t Capacity>
+struct ArgumentPack {
+private:
+    alignas(Variant) std::byte storage_[(Capacity > 0 ? Capacity : 1) * sizeof(Variant)];
+    size_t size_ = 0;
+
+    [[nodiscard]]
+    Variant* Data() noexcept {
+        return std::launder(reinterpret_cast<Variant*>(storage_));
+    }
+
+    [[nodiscard]]
+    const Variant* Data() const noexcept {
+        return std::launder(reinterpret_cast<const Variant*>(storage_));
+    }
+
+public:
+    ArgumentPack() noexcept = default;
+
+    template <typename... Args>
+        requires (sizeof...(Args) <= Capacity && (std::is_same_v<std::remove_cvref_t<Args>, Variant> && ...))
+    ArgumentPack(Args&&... args) noexcept {
+        (Push(std::forward<Args>(args)), ...);
+    }
+
+    ArgumentPack(const ArgumentPack& other) noexcept {
+        for (const auto& arg : other) {
+            Push(arg);
+        }
+    }
+
+    ArgumentPack(ArgumentPack&& other) noexcept {
+        for (auto& arg : other) {
+            Push(std::move(arg));
+        }
+        other.Clear();
+    }
+
+    ArgumentPack& operator=(const ArgumentPack& other) noexcept {
+        if (this != &other) {
+            Clear();
+            for (const auto& arg : other) {
+                Push(arg);
+            }
+        }
+        return *this;
+    }
+
+    ArgumentPack& operator=(ArgumentPack&& other) noexcept {
+        if (this != &other) {
+            Clear();
+            for (auto& arg : other) {
+                Push(std::move(arg));
+            }
+            other.Clear();
+        }
+        return *this;
+    }
+
+    ~ArgumentPack() {
+        Clear();
+    }
+
+    /// Returns false if the pack is full already.
+    bool Push(Variant arg) noexcept {
+        if (size_ >= Capacity) {
+            return false;
+        }
+        new(storage_ + size_ * sizeof(Variant)) Variant(std::move(arg));
+        ++size_;
+        return true;
+    }
+
+    void Clear() noexcept {
+        for (size_t i = size_; i > 0; --i) {
+            Data()[i - 1].~Variant();
+        }
+        size_ = 0;
+    }
+
+    [[nodiscard]]
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]]
+    const Variant& operator[](const size_t index) const noexcept {
+        return Data()[index];
+    }
+
+    [[nodiscard]]
+    Variant* begin() noexcept {
+        return Data();
+    }
+
+    [[nodiscard]]
+    Variant* end() noexcept {
+        return Data() + size_;
+    }
+
+    [[nodiscard]]
+    const Variant* begin() const noexcept {
+        return Data();
+    }
+
+    [[nodiscard]]
+    const Variant* end() const noexcept {
+        return Data() + size_;
+    }
+
+    [[nodiscard]]
+    ArgumentSpan Span() const noexcept {
+        return { Data(), size_ };
+    }
+
+    operator ArgumentSpan() const noexcept {
+        return Span();
+    }
+};
+
+template <typename... Args>
+ArgumentPack(Args&&...) -> ArgumentPack<sizeof...(Args)>;
+
+namespace detail {
+/// Variant referring to 'obj' instead of copying it, so methods act on 'obj' itself.
+/// Temporaries keep their value category like arguments do, so they go to methods qualified with '&&'
+/// or without a reference qualifier, but not to ones qualified with '&'.
+template <typename T>
+rescpp::result<Variant, ReflectError> MakeObjectView(T&& obj) {
+    using CleanT = std::remove_cvref_t<T>;
+
+    if constexpr (std::is_same_v<CleanT, Variant>) {
+        return obj;
+    }
+    else if constexpr (std::is_pointer_v<CleanT>) {
+        return Variant::Create<CleanT>(obj);
+    }
+    else if constexpr (std::is_lvalue_reference_v<T>) {
+        return Variant::Create<std::remove_reference_t<T>&>(obj);
+    }
+    else if constexpr (IsInlineVariantValue<CleanT>) {
+        return Variant::CreateTemporary<std::remove_reference_t<T>>(obj);
+    }
+    else {
+        // the temporary lives until the end of the call
+        return Variant::Create<std::remove_reference_t<T>&&>(std::move(obj));
+    }
+}
+
+/// Variant for passing 'arg' without allocating.
+/// Mutable lvalues are referred to, so reference parameters can write to them.
+/// Small trivially copyable values are copied inline, other values are referred to,
+/// both keeping their value category, so const values and temporaries only go to
+/// by-value, const reference and rvalue reference parameters, like they would in a native call.
+/// Pointers and variants are taken as they are and arrays decay to pointers.
+template <typename T>
+rescpp::result<Variant, ReflectError> MakeArgumentView(T&& arg) {
+    using CleanT = std::remove_cvref_t<T>;
+    constexpr bool IsMutableLValue = std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>;
+
+    if constexpr (std::is_same_v<CleanT, Variant>) {
+        return arg;
+    }
+    else if constexpr (std::is_array_v<std::remove_reference_t<T>>) {
+        return Variant::Create<std::remove_extent_t<std::remove_reference_t<T>>*>(arg);
+    }
+    else if constexpr (std::is_pointer_v<CleanT>) {
+        return Variant::Create<CleanT>(arg);
+    }
+    else if constexpr (IsMutableLValue) {
+        return Variant::Create<CleanT&>(arg);
+    }
+    else if constexpr (IsInlineVariantValue<CleanT> && std::is_lvalue_reference_v<T>) {
+        return Variant::Create<const CleanT>(arg);
+    }
+    else if constexpr (IsInlineVariantValue<CleanT>) {
+        return Variant::CreateTemporary<std::remove_reference_t<T>>(arg);
+    }
+    else if constexpr (std::is_lvalue_reference_v<T>) {
+        return Variant::Create<const CleanT&>(arg);
+    }
+    else {
+        // the temporary lives until the end of the call
+        return Variant::Create<std::remove_reference_t<T>&&>(std::move(arg));
+    }
+}
+
+template <size_t Capacity, typename First, typename... Rest>
+rescpp::result<void, ReflectError> PushArgumentViews(ArgumentPack<Capacity>& pack, First&& first, Rest&&... rest) {
+    pack.Push(TRY(MakeArgumentView<First>(std::forward<First>(first))));
+
+    if constexpr (sizeof...(Rest) == 0) {
+        return {};
+    }
+    else {
+        return PushArgumentViews(pack, std::forward<Rest>(rest)...);
+    }
+}
+}
+}
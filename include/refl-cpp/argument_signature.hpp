@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "refl-cpp/variant.hpp"
+#include "refl-cpp/argument.hpp"
+#include "refl-cpp/declare_reflect.hpp"
+
+namespace ReflCpp {
+/// What overload resolution looks at of a single argument.
+struct ArgumentKey {
+    TypeID type;
+    detail::VariantWrapperType wrapper;
+
+    [[nodiscard]]
+    static ArgumentKey Of(const Variant& arg) noexcept {
+        return { arg.GetType(), arg.GetWrapperType() };
+    }
+
+    [[nodiscard]]
+    constexpr bool operator==(const ArgumentKey&) const noexcept = default;
+};
+
+/// Shape of an argument list, without the values.
+struct ArgumentSignature {
+private:
+    std::vector<ArgumentKey> args_;
+
+public:
+    ArgumentSignature() = default;
+
+    ArgumentSignature(std::vector<ArgumentKey> args)
+        : args_(std::move(args)) {}
+
+    [[nodiscard]]
+    static ArgumentSignature Of(const ArgumentSpan args) {
+        std::vector<ArgumentKey> keys;
+        keys.reserve(args.size());
+        for (const auto& arg : args) {
+            keys.push_back(ArgumentKey::Of(arg));
+        }
+        return keys;
+    }
+
+    /// Signature of the arguments 'Variant::Create<Args>(...)...' would make.
+    template <typename... Args>
+    [[nodiscard]]
+    static rescpp::result<ArgumentSignature, ReflectError> Of();
+
+    [[nodiscard]]
+    size_t Size() const noexcept {
+        return args_.size();
+    }
+
+    [[nodiscard]]
+    const ArgumentKey& operator[](const size_t index) const noexcept {
+        return args_[index];
+    }
+
+    [[nodiscard]]
+    auto begin() const noexcept {
+        return args_.begin();
+    }
+
+    [[nodiscard]]
+    auto end() const noexcept {
+        return args_.end();
+    }
+
+    [[nodiscard]]
+    bool Matches(const ArgumentSpan args) const noexcept {
+        if (args.size() != args_.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < args_.size(); ++i) {
+            if (args_[i] != ArgumentKey::Of(args[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]]
+    bool operator==(const ArgumentSignature&) const noexcept = default;
+};
+}
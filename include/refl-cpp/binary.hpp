@@ -0,0 +1,312 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "refl-cpp/reflect.hpp"
+#include "refl-cpp/type_plan_cache.hpp"
+#include "refl-cpp/common/unreachable.hpp"
+
+namespace ReflCpp {
+enum class BinaryError : uint8_t {
+    /// A field type is neither trivially copyable, a string, nor made of reflected fields,
+    /// or the offset of a base is not known.
+    Unsupported,
+    /// The buffer ends before the object does.
+    Truncated,
+    /// The length prefix does not match the bytes the object took.
+    LengthMismatch,
+
+    TypeNotFound,
+
+    ReflectMaxLimitReached,
+    ReflectCreationFailed,
+    ReflectIDCollision,
+
+    OutOfMemory,
+};
+}
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::ReflectError, ReflCpp::BinaryError> {
+    static ReflCpp::BinaryError convert(const ReflCpp::ReflectError& error) noexcept {
+        switch (error) {
+            case ReflCpp::ReflectError::MaxLimitReached:
+                return ReflCpp::BinaryError::ReflectMaxLimitReached;
+            case ReflCpp::ReflectError::CreationFailed:
+                return ReflCpp::BinaryError::ReflectCreationFailed;
+            case ReflCpp::ReflectError::OutOfMemory:
+                return ReflCpp::BinaryError::OutOfMemory;
+            case ReflCpp::ReflectError::IDCollision:
+                return ReflCpp::BinaryError::ReflectIDCollision;
+        }
+        ReflCpp::unreachable<true>();
+    }
+};
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::GetTypeError, ReflCpp::BinaryError> {
+    static ReflCpp::BinaryError convert(const ReflCpp::GetTypeError&) noexcept {
+        return ReflCpp::BinaryError::TypeNotFound;
+    }
+};
+
+namespace ReflCpp {
+/// How objects of a type are written, built once per type.
+struct BinaryPlan {
+    enum class Kind : uint8_t {
+        /// 'size' bytes copied as they are.
+        Bytes,
+        /// Length prefixed characters of a 'std::string'.
+        String,
+        /// Every base and then every non-static field one after another.
+        Fields,
+    };
+
+    struct Entry {
+        const Field* field;
+        const BinaryPlan* plan;
+    };
+
+    struct BaseEntry {
+        /// Offset of the base within the object.
+        size_t offset;
+        const BinaryPlan* plan;
+    };
+
+    TypeID type = TypeID::Invalid();
+    Kind kind = Kind::Bytes;
+    size_t size = 0;
+    std::vector<BaseEntry> bases;
+    std::vector<Entry> fields;
+
+    template <typename Cache>
+    [[nodiscard]]
+    static rescpp::result<void, BinaryError> Build(Cache& cache, const Type& type, BinaryPlan& plan) noexcept {
+        const TypeLayout& layout = type.GetLayout();
+        if (type.GetFlags().Has(TypeFlags::IsPointer) || layout.size == 0) {
+            return rescpp::fail(BinaryError::Unsupported);
+        }
+
+        plan.type = type.GetID();
+        plan.size = layout.size;
+
+        if (type.Is<std::string>()) {
+            plan.kind = Kind::String;
+            return {};
+        }
+        if (type.GetFields().empty() && !type.HasBases()) {
+            if (!layout.triviallyCopyable) {
+                return rescpp::fail(BinaryError::Unsupported);
+            }
+            plan.kind = Kind::Bytes;
+            return {};
+        }
+
+        plan.kind = Kind::Fields;
+
+        // packed if the fields cover every byte, so the object can be copied as a whole
+        bool packed = layout.triviallyCopyable;
+        size_t covered = 0;
+        for (size_t i = 0; i < type.GetBases().size(); ++i) {
+            const Type& base_type = TRY(type.GetBase(i));
+            if (base_type.GetLayout().empty) {
+                // nothing to write, it shares its address with the first field
+                continue;
+            }
+
+            const std::optional<size_t> offset = type.GetBaseOffset(i);
+            if (!offset.has_value()) {
+                return rescpp::fail(BinaryError::Unsupported);
+            }
+
+            const BinaryPlan& base_plan = TRY(cache.GetLocked(base_type));
+            try {
+                plan.bases.push_back({ *offset, &base_plan });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(BinaryError::OutOfMemory);
+            }
+
+            packed = packed && base_plan.kind == Kind::Bytes;
+            covered += base_plan.size;
+        }
+
+        for (const Field& field : type.GetFields()) {
+            if (field.IsStatic()) {
+                continue;
+            }
+
+            const Type& field_type = TRY(detail::Reflect(TRY(field.GetType())));
+            const BinaryPlan& field_plan = TRY(cache.GetLocked(field_type));
+            try {
+                plan.fields.push_back({ &field, &field_plan });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(BinaryError::OutOfMemory);
+            }
+
+            packed = packed && !field.IsConst() && field_plan.kind == Kind::Bytes;
+            covered += field_plan.size;
+        }
+
+        if (packed && covered == layout.size) {
+            plan.kind = Kind::Bytes;
+            plan.bases.clear();
+            plan.fields.clear();
+        }
+        return {};
+    }
+};
+
+namespace detail {
+using BinaryPlanCache = TypePlanCache<BinaryPlan, BinaryError>;
+
+inline void WriteBinary(std::vector<std::byte>& out, const void* data, const size_t size) {
+    const auto* bytes = static_cast<const std::byte*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+inline void WriteBinary(const BinaryPlan& plan, const void* object, std::vector<std::byte>& out) {
+    switch (plan.kind) {
+        case BinaryPlan::Kind::Bytes:
+            WriteBinary(out, object, plan.size);
+            return;
+        case BinaryPlan::Kind::String: {
+            const auto& string = *static_cast<const std::string*>(object);
+            const uint64_t length = string.size();
+            WriteBinary(out, &length, sizeof(length));
+            WriteBinary(out, string.data(), string.size());
+            return;
+        }
+        case BinaryPlan::Kind::Fields:
+            for (const auto& base : plan.bases) {
+                WriteBinary(*base.plan, static_cast<const std::byte*>(object) + base.offset, out);
+            }
+            for (const auto& entry : plan.fields) {
+                WriteBinary(*entry.plan, entry.field->AddressIn(object), out);
+            }
+            return;
+    }
+}
+
+struct BinaryReader {
+    std::span<const std::byte> data;
+    size_t position = 0;
+
+    /// Copies 'size' bytes into 'out', or skips them if it is null.
+    [[nodiscard]]
+    rescpp::result<void, BinaryError> Read(void* out, const size_t size) noexcept {
+        if (data.size() - position < size) {
+            return rescpp::fail(BinaryError::Truncated);
+        }
+        if (out) {
+            std::memcpy(out, data.data() + position, size);
+        }
+        position += size;
+        return {};
+    }
+};
+
+/// A null 'object' skips the bytes, which is done for const fields.
+inline rescpp::result<void, BinaryError> ReadBinary(const BinaryPlan& plan, BinaryReader& reader, void* object) noexcept {
+    switch (plan.kind) {
+        case BinaryPlan::Kind::Bytes:
+            return reader.Read(object, plan.size);
+        case BinaryPlan::Kind::String: {
+            uint64_t length;
+            TRY(reader.Read(&length, sizeof(length)));
+            if (reader.data.size() - reader.position < length) {
+                return rescpp::fail(BinaryError::Truncated);
+            }
+            if (object) {
+                try {
+                    static_cast<std::string*>(object)->assign(
+                        reinterpret_cast<const char*>(reader.data.data() + reader.position), length);
+                }
+                catch (const std::exception&) {
+                    return rescpp::fail(BinaryError::OutOfMemory);
+                }
+            }
+            reader.position += length;
+            return {};
+        }
+        case BinaryPlan::Kind::Fields:
+            for (const auto& base : plan.bases) {
+                TRY(ReadBinary(*base.plan, reader, object ? static_cast<std::byte*>(object) + base.offset : nullptr));
+            }
+            for (const auto& entry : plan.fields) {
+                void* field = object && !entry.field->IsConst() ? entry.field->AddressIn(object) : nullptr;
+                TRY(ReadBinary(*entry.plan, reader, field));
+            }
+            return {};
+    }
+    ReflCpp::unreachable<true>();
+}
+}
+
+/// Appends 'object' as a 64 bit byte length followed by its bases and fields, in the byte order of the machine.
+/// Trivially copyable types whose reflected fields cover every byte are written with a single copy.
+[[nodiscard]]
+inline rescpp::result<void, BinaryError> SerializeBinary(const Type& type, const void* object, std::vector<std::byte>& out) noexcept {
+    const BinaryPlan& plan = TRY(detail::BinaryPlanCache::Instance().Get(type));
+    try {
+        const size_t start = out.size();
+        out.resize(start + sizeof(uint64_t));
+        detail::WriteBinary(plan, object, out);
+
+        const uint64_t length = out.size() - start - sizeof(uint64_t);
+        std::memcpy(out.data() + start, &length, sizeof(length));
+    }
+    catch (const std::exception&) {
+        return rescpp::fail(BinaryError::OutOfMemory);
+    }
+    return {};
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<void, BinaryError> SerializeBinary(const T& object, std::vector<std::byte>& out) noexcept {
+    return SerializeBinary(TRY(Reflect<T>()), &object, out);
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<std::vector<std::byte>, BinaryError> SerializeBinary(const T& object) noexcept {
+    std::vector<std::byte> out;
+    TRY(SerializeBinary(object, out));
+    return out;
+}
+
+/// Reads one object written by 'SerializeBinary' into 'object' and returns the bytes it took,
+/// so objects written one after another can be read the same way.
+/// Const fields are skipped and keep their value.
+[[nodiscard]]
+inline rescpp::result<size_t, BinaryError> DeserializeBinary(const Type& type, std::span<const std::byte> in, void* object) noexcept {
+    const BinaryPlan& plan = TRY(detail::BinaryPlanCache::Instance().Get(type));
+
+    uint64_t length;
+    detail::BinaryReader prefix{ in };
+    TRY(prefix.Read(&length, sizeof(length)));
+    if (in.size() - sizeof(length) < length) {
+        return rescpp::fail(BinaryError::Truncated);
+    }
+
+    detail::BinaryReader reader{ in.subspan(sizeof(length), length) };
+    TRY(detail::ReadBinary(plan, reader, object));
+    if (reader.position != length) {
+        return rescpp::fail(BinaryError::LengthMismatch);
+    }
+    return sizeof(length) + length;
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<size_t, BinaryError> DeserializeBinary(std::span<const std::byte> in, T& object) noexcept {
+    return DeserializeBinary(TRY(Reflect<T>()), in, &object);
+}
+}
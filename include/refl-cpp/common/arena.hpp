@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ReflCpp::detail {
+struct ArenaStats {
+    /// Bytes handed out, without alignment padding.
+    size_t used = 0;
+    /// Bytes of every block together.
+    size_t reserved = 0;
+    size_t blocks = 0;
+};
+
+/// Bump allocator for objects living as long as the arena, which frees them all at once.
+/// Objects allocated one after another end up next to each other,
+/// and destructors are run in reverse order of creation when the arena is destroyed.
+/// Allocating is serialized by a mutex, constructing is not.
+struct Arena {
+private:
+    struct Destructor {
+        void (*destroy)(void*) noexcept;
+        void* object;
+    };
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::vector<Destructor> destructors_;
+
+    std::byte* next_ = nullptr;
+    std::byte* end_ = nullptr;
+    size_t nextBlockSize_;
+    ArenaStats stats_;
+
+    void AddBlock(const size_t min_size) {
+        const size_t size = std::max(nextBlockSize_, min_size);
+        blocks_.reserve(blocks_.size() + 1);
+        blocks_.emplace_back(new std::byte[size]);
+
+        next_ = blocks_.back().get();
+        end_ = next_ + size;
+        nextBlockSize_ = std::min(nextBlockSize_ * 2, MaxBlockSize);
+        stats_.reserved += size;
+        stats_.blocks += 1;
+    }
+
+public:
+    static constexpr size_t InitialBlockSize = 16 * 1024;
+    static constexpr size_t MaxBlockSize = 1024 * 1024;
+
+    explicit Arena(const size_t initialBlockSize = InitialBlockSize) noexcept
+        : nextBlockSize_(initialBlockSize) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() {
+        for (auto it = destructors_.rbegin(); it != destructors_.rend(); ++it) {
+            it->destroy(it->object);
+        }
+    }
+
+    /// Throws 'std::bad_alloc' like 'operator new' does.
+    [[nodiscard]]
+    void* Allocate(const size_t size, const size_t alignment) {
+        std::lock_guard lock(mutex_);
+
+        void* ptr = next_;
+        size_t space = end_ - next_;
+        if (!ptr || !std::align(alignment, size, ptr, space)) {
+            AddBlock(size + alignment);
+            ptr = next_;
+            space = end_ - next_;
+            (void)std::align(alignment, size, ptr, space);
+        }
+
+        next_ = static_cast<std::byte*>(ptr) + size;
+        stats_.used += size;
+        return ptr;
+    }
+
+    template <typename T, typename... Args>
+    [[nodiscard]]
+    T* Create(Args&&... args) {
+        T* object = new(Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::lock_guard lock(mutex_);
+            try {
+                destructors_.push_back({
+                    [](void* ptr) noexcept { static_cast<T*>(ptr)->~T(); },
+                    object,
+                });
+            }
+            catch (...) {
+                object->~T();
+                throw;
+            }
+        }
+        return object;
+    }
+
+    /// Copies 'values' next to each other. Only for types without a destructor.
+    template <typename T>
+        requires std::is_trivially_destructible_v<T> && std::is_trivially_copyable_v<T>
+    [[nodiscard]]
+    std::span<T> CreateRange(const std::span<const T> values) {
+        if (values.empty()) {
+            return {};
+        }
+
+        auto* data = static_cast<T*>(Allocate(values.size_bytes(), alignof(T)));
+        std::uninitialized_copy(values.begin(), values.end(), data);
+        return { data, values.size() };
+    }
+
+    [[nodiscard]]
+    ArenaStats GetStats() noexcept {
+        std::lock_guard lock(mutex_);
+        return stats_;
+    }
+};
+
+/// Holds the wrappers behind fields and methods and the types of the database.
+/// They are created before the database sees them, so the arena is shared by every part of it.
+inline Arena& MetadataArena() {
+    static Arena arena;
+    return arena;
+}
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace ReflCpp::detail {
+/// Append-only table of pointers which can be read without locking.
+/// Entries live in chunks of doubling size which never move once allocated,
+/// so a published entry stays valid for the lifetime of the table.
+/// Appending has to be serialized by the caller.
+template <typename T>
+struct ChunkedTable {
+private:
+    using Slot = std::atomic<T*>;
+
+    static constexpr size_t FirstChunkBits = 6;
+    static constexpr size_t FirstChunkSize = size_t(1) << FirstChunkBits;
+    static constexpr size_t ChunkCount = 32 - FirstChunkBits;
+
+    std::array<std::atomic<Slot*>, ChunkCount> chunks_{};
+    std::atomic<size_t> size_ = 0;
+
+    // chunk 'n' holds 'FirstChunkSize << n' entries and starts at '(FirstChunkSize << n) - FirstChunkSize'
+    static constexpr size_t ChunkOf(const size_t index) noexcept {
+        return std::bit_width(index + FirstChunkSize) - FirstChunkBits - 1;
+    }
+
+    static constexpr size_t ChunkSize(const size_t chunk) noexcept {
+        return FirstChunkSize << chunk;
+    }
+
+    static constexpr size_t ChunkStart(const size_t chunk) noexcept {
+        return ChunkSize(chunk) - FirstChunkSize;
+    }
+
+public:
+    static constexpr size_t Capacity = ChunkStart(ChunkCount);
+
+    ChunkedTable() = default;
+
+    ChunkedTable(const ChunkedTable&) = delete;
+    ChunkedTable& operator=(const ChunkedTable&) = delete;
+
+    ~ChunkedTable() {
+        for (auto& chunk : chunks_) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]]
+    size_t Size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    /// Returns 'nullptr' if 'index' was not published yet.
+    [[nodiscard]]
+    T* Get(const size_t index) const noexcept {
+        // acquiring the size makes everything stored before publishing it visible
+        if (index >= size_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        const size_t chunk = ChunkOf(index);
+        const Slot* slots = chunks_[chunk].load(std::memory_order_relaxed);
+        return slots[index - ChunkStart(chunk)].load(std::memory_order_relaxed);
+    }
+
+    /// Allocates the slot of the next entry, so appending it cannot fail.
+    /// Returns false if the table is full or out of memory.
+    bool Reserve() noexcept {
+        const size_t index = size_.load(std::memory_order_relaxed);
+        if (index >= Capacity) {
+            return false;
+        }
+
+        const size_t chunk = ChunkOf(index);
+        if (!chunks_[chunk].load(std::memory_order_relaxed)) {
+            Slot* slots = new(std::nothrow) Slot[ChunkSize(chunk)]{};
+            if (!slots) {
+                return false;
+            }
+            chunks_[chunk].store(slots, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /// Returns the index 'value' got stored at or 'SIZE_MAX' if the table is full or out of memory.
+    size_t Append(T* value) noexcept {
+        if (!Reserve()) {
+            return SIZE_MAX;
+        }
+
+        const size_t index = size_.load(std::memory_order_relaxed);
+        const size_t chunk = ChunkOf(index);
+        Slot* slots = chunks_[chunk].load(std::memory_order_relaxed);
+        slots[index - ChunkStart(chunk)].store(value, std::memory_order_relaxed);
+        size_.store(index + 1, std::memory_order_release);
+        return index;
+    }
+};
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace ReflCpp::detail {
+/// Open addressing map from non zero 32 bit ids to pointers which can be read without locking.
+/// Growing publishes a new table and keeps the old ones alive, so readers never touch freed memory.
+/// Inserting has to be serialized by the caller.
+template <typename T>
+struct ConcurrentIDMap {
+private:
+    struct Slot {
+        std::atomic<uint32_t> key = 0;
+        std::atomic<T*> value = nullptr;
+    };
+
+    struct Table {
+        size_t mask;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    static constexpr size_t InitialCapacity = 64;
+
+    std::atomic<const Table*> table_ = nullptr;
+    std::vector<std::unique_ptr<Table>> tables_;
+    size_t size_ = 0;
+
+    // ids are already hashes or sequential, so mixing them once is enough to spread them
+    static constexpr size_t Mix(const uint32_t key) noexcept {
+        return key * 0x9E3779B1u;
+    }
+
+    static void Insert(const Table& table, const uint32_t key, T* value) noexcept {
+        for (size_t i = Mix(key) & table.mask;; i = (i + 1) & table.mask) {
+            Slot& slot = table.slots[i];
+            if (slot.key.load(std::memory_order_relaxed) == 0) {
+                slot.value.store(value, std::memory_order_relaxed);
+                // readers acquire the key, which publishes the value stored before it
+                slot.key.store(key, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    bool Grow() noexcept {
+        const Table* current = table_.load(std::memory_order_relaxed);
+        const size_t capacity = current ? (current->mask + 1) * 2 : InitialCapacity;
+
+        auto table = std::unique_ptr<Table>(new(std::nothrow) Table{
+            .mask = capacity - 1,
+            .slots = std::unique_ptr<Slot[]>(new(std::nothrow) Slot[capacity]),
+        });
+        if (!table || !table->slots) {
+            return false;
+        }
+
+        if (current) {
+            for (size_t i = 0; i <= current->mask; ++i) {
+                const Slot& slot = current->slots[i];
+                if (const uint32_t key = slot.key.load(std::memory_order_relaxed); key != 0) {
+                    Insert(*table, key, slot.value.load(std::memory_order_relaxed));
+                }
+            }
+        }
+
+        try {
+            tables_.reserve(tables_.size() + 1);
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+
+        table_.store(table.get(), std::memory_order_release);
+        tables_.push_back(std::move(table));
+        return true;
+    }
+
+public:
+    ConcurrentIDMap() = default;
+
+    ConcurrentIDMap(const ConcurrentIDMap&) = delete;
+    ConcurrentIDMap& operator=(const ConcurrentIDMap&) = delete;
+
+    [[nodiscard]]
+    T* Find(const uint32_t key) const noexcept {
+        const Table* table = table_.load(std::memory_order_acquire);
+        if (!table || key == 0) {
+            return nullptr;
+        }
+
+        for (size_t i = Mix(key) & table->mask;; i = (i + 1) & table->mask) {
+            const Slot& slot = table->slots[i];
+            const uint32_t slot_key = slot.key.load(std::memory_order_acquire);
+            if (slot_key == key) {
+                return slot.value.load(std::memory_order_relaxed);
+            }
+            if (slot_key == 0) {
+                return nullptr;
+            }
+        }
+    }
+
+    [[nodiscard]]
+    bool Contains(const uint32_t key) const noexcept {
+        return Find(key) != nullptr;
+    }
+
+    /// Grows the map if needed, so inserting the next key cannot fail.
+    /// Returns false if growing the map ran out of memory.
+    bool Reserve() noexcept {
+        // keep the load factor at or below one half
+        const Table* table = table_.load(std::memory_order_relaxed);
+        if (!table || (size_ + 1) * 2 > table->mask + 1) {
+            return Grow();
+        }
+        return true;
+    }
+
+    /// Expects 'key' to not be present yet.
+    /// Returns false if growing the map ran out of memory.
+    bool Insert(const uint32_t key, T* value) noexcept {
+        if (!Reserve()) {
+            return false;
+        }
+
+        Insert(*table_.load(std::memory_order_relaxed), key, value);
+        ++size_;
+        return true;
+    }
+};
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ReflCpp::detail {
+inline constexpr uint64_t HashPrime1 = 0x9E3779B185EBCA87ull;
+inline constexpr uint64_t HashPrime2 = 0xC2B2AE3D27D4EB4Full;
+inline constexpr uint64_t HashPrime3 = 0x165667B19E3779F9ull;
+inline constexpr uint64_t HashPrime4 = 0x85EBCA77C2B2AE63ull;
+inline constexpr uint64_t HashPrime5 = 0x27D4EB2F165667C5ull;
+
+[[nodiscard]]
+inline uint64_t LoadHash64(const std::byte* data) noexcept {
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+[[nodiscard]]
+constexpr uint64_t HashRound(uint64_t acc, const uint64_t input) noexcept {
+    acc += input * HashPrime2;
+    acc = std::rotl(acc, 31);
+    return acc * HashPrime1;
+}
+
+/// Spreads every input bit over the whole hash.
+[[nodiscard]]
+constexpr uint64_t HashAvalanche(uint64_t hash) noexcept {
+    hash ^= hash >> 33;
+    hash *= HashPrime2;
+    hash ^= hash >> 29;
+    hash *= HashPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/// Mixes an already good 64 bit hash into 'hash', so the order values are mixed in matters.
+[[nodiscard]]
+constexpr uint64_t MixHash(const uint64_t hash, const uint64_t value) noexcept {
+    return std::rotl(hash ^ HashRound(0, value), 27) * HashPrime1 + HashPrime4;
+}
+
+/// xxHash64 of 'size' bytes. Blocks of 32 bytes go through four independent lanes,
+/// so the multiplications of one block do not wait on each other.
+[[nodiscard]]
+inline uint64_t HashBytes(const void* data, const size_t size, const uint64_t seed = 0) noexcept {
+    const auto* it = static_cast<const std::byte*>(data);
+    const std::byte* const end = it + size;
+
+    uint64_t hash;
+    if (size >= 32) {
+        uint64_t lane0 = seed + HashPrime1 + HashPrime2;
+        uint64_t lane1 = seed + HashPrime2;
+        uint64_t lane2 = seed;
+        uint64_t lane3 = seed - HashPrime1;
+        for (; end - it >= 32; it += 32) {
+            lane0 = HashRound(lane0, LoadHash64(it));
+            lane1 = HashRound(lane1, LoadHash64(it + 8));
+            lane2 = HashRound(lane2, LoadHash64(it + 16));
+            lane3 = HashRound(lane3, LoadHash64(it + 24));
+        }
+
+        hash = std::rotl(lane0, 1) + std::rotl(lane1, 7) + std::rotl(lane2, 12) + std::rotl(lane3, 18);
+        for (const uint64_t lane : { lane0, lane1, lane2, lane3 }) {
+            hash = (hash ^ HashRound(0, lane)) * HashPrime1 + HashPrime4;
+        }
+    }
+    else {
+        hash = seed + HashPrime5;
+    }
+
+    hash += size;
+    for (; end - it >= 8; it += 8) {
+        hash = MixHash(hash, LoadHash64(it));
+    }
+    if (end - it >= 4) {
+        uint32_t value;
+        std::memcpy(&value, it, sizeof(value));
+        hash ^= value * HashPrime1;
+        hash = std::rotl(hash, 23) * HashPrime2 + HashPrime3;
+        it += 4;
+    }
+    for (; it < end; ++it) {
+        hash ^= static_cast<uint64_t>(*it) * HashPrime5;
+        hash = std::rotl(hash, 11) * HashPrime1;
+    }
+    return HashAvalanche(hash);
+}
+}
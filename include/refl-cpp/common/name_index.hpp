@@ -0,0 +1,94 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace ReflCpp::detail {
+/// FNV-1a hash of a member name.
+constexpr uint64_t HashName(const std::string_view name) noexcept {
+    uint64_t hash = 14695981039346656037ull;
+    for (const char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// Mixes 'value' into 'hash', so the order values are combined in matters.
+constexpr uint64_t CombineHash(const uint64_t hash, const uint64_t value) noexcept {
+    return (hash ^ value) * 1099511628211ull + (hash >> 29);
+}
+
+/// Open addressing table from names to their index, built once and only read afterwards.
+/// Hashes are stored next to the names, so a probe only compares strings on a full hash match.
+struct NameIndex {
+private:
+    struct Entry {
+        uint64_t hash = 0;
+        std::string_view name;
+        size_t index = NotFound;
+    };
+
+    std::vector<Entry> entries_;
+    size_t mask_ = 0;
+
+public:
+    static constexpr size_t NotFound = SIZE_MAX;
+
+    NameIndex() = default;
+
+    /// 'names' has to outlive the index.
+    /// If a name shows up more than once the first one wins.
+    template <typename Range, typename Projection>
+    NameIndex(const Range& names, Projection projection) {
+        const size_t count = std::size(names);
+        if (count == 0) {
+            return;
+        }
+
+        // load factor of at most one half keeps probe sequences short
+        entries_.resize(std::bit_ceil(count * 2));
+        mask_ = entries_.size() - 1;
+
+        size_t index = 0;
+        for (const auto& element : names) {
+            const std::string_view name = projection(element);
+            const uint64_t hash = HashName(name);
+
+            for (size_t i = hash & mask_;; i = (i + 1) & mask_) {
+                Entry& entry = entries_[i];
+                if (entry.index == NotFound) {
+                    entry = Entry{ .hash = hash, .name = name, .index = index };
+                    break;
+                }
+                if (entry.hash == hash && entry.name == name) {
+                    break;
+                }
+            }
+            ++index;
+        }
+    }
+
+    [[nodiscard]]
+    size_t Find(const std::string_view name) const noexcept {
+        if (entries_.empty()) {
+            return NotFound;
+        }
+
+        const uint64_t hash = HashName(name);
+        for (size_t i = hash & mask_;; i = (i + 1) & mask_) {
+            const Entry& entry = entries_[i];
+            if (entry.index == NotFound) {
+                return NotFound;
+            }
+            if (entry.hash == hash && entry.name == name) {
+                return entry.index;
+            }
+        }
+    }
+};
+}
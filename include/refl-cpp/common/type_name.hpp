@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace ReflCpp::detail {
+template <typename T>
+constexpr std::string_view RawTypeName() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+// 'double' is used as probe, since it does not show up anywhere else in the signature
+inline constexpr std::string_view TypeNameProbe = RawTypeName<double>();
+inline constexpr size_t TypeNamePrefix = TypeNameProbe.find("double");
+inline constexpr size_t TypeNameSuffix = TypeNameProbe.size() - TypeNamePrefix - std::string_view("double").size();
+
+/// Fully qualified name of 'T' as spelled by the compiler.
+template <typename T>
+constexpr std::string_view TypeName() noexcept {
+    constexpr std::string_view raw = RawTypeName<T>();
+    return raw.substr(TypeNamePrefix, raw.size() - TypeNamePrefix - TypeNameSuffix);
+}
+
+constexpr bool IsIdentifierChar(const char c) noexcept {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+/// FNV-1a hash of a type name, which skips whitespace and the
+/// 'struct', 'class', 'enum' and 'union' keywords some compilers put in.
+/// Never returns 0, since that is used as invalid id.
+constexpr uint32_t HashTypeName(const std::string_view name) noexcept {
+    constexpr std::string_view keywords[] = { "struct ", "class ", "enum ", "union " };
+
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < name.size(); ++i) {
+        if (i == 0 || !IsIdentifierChar(name[i - 1])) {
+            bool skipped = false;
+            for (const auto keyword : keywords) {
+                if (name.substr(i).starts_with(keyword)) {
+                    i += keyword.size() - 1;
+                    skipped = true;
+                    break;
+                }
+            }
+            if (skipped) {
+                continue;
+            }
+        }
+
+        if (name[i] == ' ') {
+            continue;
+        }
+
+        hash ^= static_cast<uint8_t>(name[i]);
+        hash *= 16777619u;
+    }
+
+    return hash == 0 ? 1 : hash;
+}
+}
@@ -4,6 +4,14 @@
 
 namespace ReflCpp {
 namespace detail {
+/// Only its address is used, which is unique per 'T'.
+/// Comparing it does not need 'T' to be reflected.
+/// Not const, since linkers may fold identical constants into one address, like MSVC does with '/OPT:ICF'.
+template <typename T>
+struct TypeTag {
+    static inline char ID = 0;
+};
+
 template <typename T>
 struct make_const {
     using type = std::add_const_t<std::remove_const_t<T>>;
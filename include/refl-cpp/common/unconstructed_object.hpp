@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ReflCpp::detail {
+/// Storage of a 'C' which is never constructed, for taking addresses of its members and bases.
+/// Not constexpr, so it lands zero filled in .bss instead of taking 'sizeof(C)' bytes of the binary.
+template <typename C>
+const std::byte* UnconstructedObject() noexcept {
+    alignas(C) static std::byte storage[sizeof(C)];
+    return storage;
+}
+
+/// Byte offset of 'address' within the storage of 'UnconstructedObject<C>'.
+template <typename C>
+size_t OffsetInUnconstructed(const void* address) noexcept {
+    return static_cast<const std::byte*>(address) - UnconstructedObject<C>();
+}
+}
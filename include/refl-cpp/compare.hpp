@@ -0,0 +1,357 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "refl-cpp/reflect.hpp"
+#include "refl-cpp/type_plan_cache.hpp"
+#include "refl-cpp/common/unreachable.hpp"
+
+namespace ReflCpp {
+enum class CompareError : uint8_t {
+    /// A field type is neither trivially copyable, a string, nor made of reflected fields,
+    /// or the offset of a base is not known.
+    /// 'Compare' also reports it for types holding bytes without a known order.
+    Unsupported,
+
+    TypeNotFound,
+
+    ReflectMaxLimitReached,
+    ReflectCreationFailed,
+    ReflectIDCollision,
+
+    OutOfMemory,
+};
+}
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::ReflectError, ReflCpp::CompareError> {
+    static ReflCpp::CompareError convert(const ReflCpp::ReflectError& error) noexcept {
+        switch (error) {
+            case ReflCpp::ReflectError::MaxLimitReached:
+                return ReflCpp::CompareError::ReflectMaxLimitReached;
+            case ReflCpp::ReflectError::CreationFailed:
+                return ReflCpp::CompareError::ReflectCreationFailed;
+            case ReflCpp::ReflectError::OutOfMemory:
+                return ReflCpp::CompareError::OutOfMemory;
+            case ReflCpp::ReflectError::IDCollision:
+                return ReflCpp::CompareError::ReflectIDCollision;
+        }
+        ReflCpp::unreachable<true>();
+    }
+};
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::GetTypeError, ReflCpp::CompareError> {
+    static ReflCpp::CompareError convert(const ReflCpp::GetTypeError&) noexcept {
+        return ReflCpp::CompareError::TypeNotFound;
+    }
+};
+
+namespace ReflCpp {
+namespace detail {
+template <typename T>
+[[nodiscard]]
+std::partial_ordering CompareValues(const void* lhs, const void* rhs) noexcept {
+    T left;
+    T right;
+    std::memcpy(&left, lhs, sizeof(T));
+    std::memcpy(&right, rhs, sizeof(T));
+    return left <=> right;
+}
+
+[[nodiscard]]
+inline std::partial_ordering CompareBytes(const void* lhs, const void* rhs, const size_t size) noexcept {
+    return std::memcmp(lhs, rhs, size) <=> 0;
+}
+}
+
+/// How objects of a type are compared, built once per type.
+struct ComparePlan {
+    using CompareFunc = std::partial_ordering(*)(const void*, const void*) noexcept;
+
+    enum class Kind : uint8_t {
+        /// 'size' bytes without a known meaning, only compared for equality.
+        Bytes,
+        /// A builtin value, integer or enum compared by 'compare'.
+        Value,
+        /// A 'std::string'.
+        String,
+        /// Every base and then every non-static field compared in order.
+        Fields,
+    };
+
+    struct Entry {
+        /// Null for a base, which always has a known offset.
+        const Field* field;
+        const ComparePlan* plan;
+        /// Offset within the object, or 'UnknownOffset' to ask the field for its address.
+        size_t offset;
+    };
+
+    static constexpr size_t UnknownOffset = SIZE_MAX;
+
+    TypeID type = TypeID::Invalid();
+    Kind kind = Kind::Bytes;
+    size_t size = 0;
+    CompareFunc compare = nullptr;
+    std::vector<Entry> fields;
+
+    /// Two objects are equal if and only if their bytes are.
+    bool bitwiseEqual = false;
+    /// Two objects order the same way their bytes do under 'memcmp'.
+    bool bitwiseOrdered = false;
+    /// Whether 'Compare' knows an order, which it does not for anything holding 'Bytes'.
+    bool ordered = true;
+
+private:
+    template <typename T>
+    void SetValue() noexcept {
+        kind = Kind::Value;
+        compare = &detail::CompareValues<T>;
+        // 0.0 equals -0.0 and NaN equals nothing, so floating point values need a real compare
+        bitwiseEqual = !std::is_floating_point_v<T>;
+        bitwiseOrdered = sizeof(T) == 1 && std::is_unsigned_v<T>;
+    }
+
+    template <typename Signed, typename Unsigned>
+    void SetInteger(const bool isSigned) noexcept {
+        if (isSigned) {
+            SetValue<Signed>();
+        }
+        else {
+            SetValue<Unsigned>();
+        }
+    }
+
+    /// Integers and enums compare like the builtin integer of their size and signedness.
+    [[nodiscard]]
+    bool SetInteger(const TypeLayout& layout) noexcept {
+        switch (layout.size) {
+            case 1:
+                SetInteger<int8_t, uint8_t>(layout.signedInteger);
+                return true;
+            case 2:
+                SetInteger<int16_t, uint16_t>(layout.signedInteger);
+                return true;
+            case 4:
+                SetInteger<int32_t, uint32_t>(layout.signedInteger);
+                return true;
+            case 8:
+                SetInteger<int64_t, uint64_t>(layout.signedInteger);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+public:
+    template <typename Cache>
+    [[nodiscard]]
+    static rescpp::result<void, CompareError> Build(Cache& cache, const Type& type, ComparePlan& plan) noexcept {
+        const TypeLayout& layout = type.GetLayout();
+        if (layout.size == 0) {
+            return rescpp::fail(CompareError::Unsupported);
+        }
+
+        plan.type = type.GetID();
+        plan.size = layout.size;
+
+        if (type.Is<std::string>()) {
+            plan.kind = Kind::String;
+            return {};
+        }
+        if (type.GetFields().empty() && !type.HasBases()) {
+            if (!layout.triviallyCopyable) {
+                return rescpp::fail(CompareError::Unsupported);
+            }
+            if (type.GetFlags().Has(TypeFlags::IsPointer) && layout.size == sizeof(uintptr_t)) {
+                plan.kind = Kind::Value;
+                plan.compare = &detail::CompareValues<uintptr_t>;
+                plan.bitwiseEqual = true;
+            }
+            else if (type.Is<float>()) {
+                plan.SetValue<float>();
+            }
+            else if (type.Is<double>()) {
+                plan.SetValue<double>();
+            }
+            else if (!layout.integer || !plan.SetInteger(layout)) {
+                plan.kind = Kind::Bytes;
+                plan.bitwiseEqual = true;
+                plan.ordered = false;
+            }
+            return {};
+        }
+
+        plan.kind = Kind::Fields;
+
+        // without padding between or after the fields every byte is part of the value
+        plan.bitwiseEqual = layout.triviallyCopyable;
+        plan.bitwiseOrdered = layout.triviallyCopyable;
+        size_t covered = 0;
+        size_t next_offset = 0;
+        for (size_t i = 0; i < type.GetBases().size(); ++i) {
+            const Type& base_type = TRY(type.GetBase(i));
+            if (base_type.GetLayout().empty) {
+                continue;
+            }
+
+            const std::optional<size_t> offset = type.GetBaseOffset(i);
+            if (!offset.has_value()) {
+                return rescpp::fail(CompareError::Unsupported);
+            }
+
+            const ComparePlan& base_plan = TRY(cache.GetLocked(base_type));
+            try {
+                plan.fields.push_back({ nullptr, &base_plan, *offset });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(CompareError::OutOfMemory);
+            }
+
+            plan.bitwiseEqual = plan.bitwiseEqual && base_plan.bitwiseEqual;
+            plan.bitwiseOrdered = plan.bitwiseOrdered && base_plan.bitwiseOrdered && offset == next_offset;
+            plan.ordered = plan.ordered && base_plan.ordered;
+            covered += base_plan.size;
+            next_offset += base_plan.size;
+        }
+
+        for (const Field& field : type.GetFields()) {
+            if (field.IsStatic()) {
+                continue;
+            }
+
+            const Type& field_type = TRY(detail::Reflect(TRY(field.GetType())));
+            const ComparePlan& field_plan = TRY(cache.GetLocked(field_type));
+            const std::optional<size_t> offset = field.GetOffset();
+            try {
+                plan.fields.push_back({ &field, &field_plan, offset.value_or(UnknownOffset) });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(CompareError::OutOfMemory);
+            }
+
+            plan.bitwiseEqual = plan.bitwiseEqual && field_plan.bitwiseEqual;
+            // 'memcmp' only orders like the fields if they follow each other in memory
+            plan.bitwiseOrdered = plan.bitwiseOrdered && field_plan.bitwiseOrdered && offset == next_offset;
+            plan.ordered = plan.ordered && field_plan.ordered;
+            covered += field_plan.size;
+            next_offset += field_plan.size;
+        }
+
+        const bool packed = covered == layout.size;
+        plan.bitwiseEqual = plan.bitwiseEqual && packed;
+        plan.bitwiseOrdered = plan.bitwiseOrdered && plan.bitwiseEqual;
+        return {};
+    }
+};
+
+namespace detail {
+using ComparePlanCache = TypePlanCache<ComparePlan, CompareError>;
+
+[[nodiscard]]
+inline const void* FieldAddress(const ComparePlan::Entry& entry, const void* object) noexcept {
+    if (entry.offset != ComparePlan::UnknownOffset) {
+        return static_cast<const std::byte*>(object) + entry.offset;
+    }
+    return entry.field->AddressIn(object);
+}
+
+[[nodiscard]]
+inline bool EqualObjects(const ComparePlan& plan, const void* lhs, const void* rhs) noexcept {
+    if (plan.bitwiseEqual) {
+        return std::memcmp(lhs, rhs, plan.size) == 0;
+    }
+
+    switch (plan.kind) {
+        case ComparePlan::Kind::Bytes:
+            return std::memcmp(lhs, rhs, plan.size) == 0;
+        case ComparePlan::Kind::Value:
+            return plan.compare(lhs, rhs) == 0;
+        case ComparePlan::Kind::String:
+            return *static_cast<const std::string*>(lhs) == *static_cast<const std::string*>(rhs);
+        case ComparePlan::Kind::Fields:
+            for (const auto& entry : plan.fields) {
+                if (!EqualObjects(*entry.plan, FieldAddress(entry, lhs), FieldAddress(entry, rhs))) {
+                    return false;
+                }
+            }
+            return true;
+    }
+    ReflCpp::unreachable<true>();
+}
+
+[[nodiscard]]
+inline std::partial_ordering CompareObjects(const ComparePlan& plan, const void* lhs, const void* rhs) noexcept {
+    if (plan.bitwiseOrdered) {
+        return CompareBytes(lhs, rhs, plan.size);
+    }
+
+    switch (plan.kind) {
+        case ComparePlan::Kind::Bytes:
+            // 'Compare' rejects plans that are not ordered
+            break;
+        case ComparePlan::Kind::Value:
+            return plan.compare(lhs, rhs);
+        case ComparePlan::Kind::String:
+            return *static_cast<const std::string*>(lhs) <=> *static_cast<const std::string*>(rhs);
+        case ComparePlan::Kind::Fields:
+            for (const auto& entry : plan.fields) {
+                const std::partial_ordering order = CompareObjects(*entry.plan, FieldAddress(entry, lhs),
+                                                                   FieldAddress(entry, rhs));
+                if (order != 0) {
+                    return order;
+                }
+            }
+            return std::partial_ordering::equivalent;
+    }
+    ReflCpp::unreachable<true>();
+}
+}
+
+/// Whether every base and non-static field of 'lhs' equals the one of 'rhs', like a defaulted 'operator=='.
+/// Types whose reflected fields cover every byte and hold no floating point values are compared
+/// with a single 'memcmp'.
+[[nodiscard]]
+inline rescpp::result<bool, CompareError> Equals(const Type& type, const void* lhs, const void* rhs) noexcept {
+    const ComparePlan& plan = TRY(detail::ComparePlanCache::Instance().Get(type));
+    return detail::EqualObjects(plan, lhs, rhs);
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<bool, CompareError> Equals(const T& lhs, const T& rhs) noexcept {
+    const ComparePlan& plan = TRY(detail::ComparePlanCache::Instance().Get<T>());
+    return detail::EqualObjects(plan, &lhs, &rhs);
+}
+
+/// Compares the bases and then the non-static fields of 'lhs' and 'rhs' in order, like a defaulted 'operator<=>'.
+/// It is unordered as soon as a floating point field is NaN, and enums order like their underlying integer.
+/// Other reflected types without fields or bases have no known order and fail with 'Unsupported'.
+/// Types made of nothing but unsigned bytes are compared with a single 'memcmp'.
+[[nodiscard]]
+inline rescpp::result<std::partial_ordering, CompareError> Compare(const Type& type, const void* lhs, const void* rhs) noexcept {
+    const ComparePlan& plan = TRY(detail::ComparePlanCache::Instance().Get(type));
+    if (!plan.ordered) {
+        return rescpp::fail(CompareError::Unsupported);
+    }
+    return detail::CompareObjects(plan, lhs, rhs);
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<std::partial_ordering, CompareError> Compare(const T& lhs, const T& rhs) noexcept {
+    const ComparePlan& plan = TRY(detail::ComparePlanCache::Instance().Get<T>());
+    if (!plan.ordered) {
+        return rescpp::fail(CompareError::Unsupported);
+    }
+    return detail::CompareObjects(plan, &lhs, &rhs);
+}
+}
@@ -1,7 +1,11 @@
 #pragma once
 
 #include <vector>
+#include <mutex>
 
+#include "refl-cpp/common/arena.hpp"
+#include "refl-cpp/common/chunked_table.hpp"
+#include "refl-cpp/common/concurrent_id_map.hpp"
 #include "refl-cpp/type_id.hpp"
 #include "refl-cpp/type.hpp"
 #include "refl-cpp/reflect_printer.hpp"
@@ -21,9 +25,23 @@ concept HasReflectData = requires() {
 };
 }
 
+/// Registering types is serialized by a mutex, looking them up by id never locks.
 struct ReflectionDatabase {
 private:
-    std::vector<std::unique_ptr<Type>> types_;
+    // recursive, since creating the data of a type can register the types it refers to
+    std::recursive_mutex mutex_;
+
+    // first, so the types in it outlive the database
+    detail::Arena& arena_ = detail::MetadataArena();
+    size_t typeCount_ = 0;
+
+#ifdef REFLCPP_STABLE_TYPE_IDS
+    // stable ids are hashes, so they need to be mapped to their type
+    detail::ConcurrentIDMap<const Type> lookup_;
+#else
+    // index is id - 1
+    detail::ChunkedTable<const Type> lookup_;
+#endif
 
 public:
     static const Type& Void() noexcept {
@@ -44,9 +62,18 @@ public:
     template <typename T>
         requires detail::HasReflectData<T>
     rescpp::result<TypeID, ReflectError> RegisterType() noexcept {
-        if (types_.size() == SIZE_MAX) {
+        std::lock_guard lock(mutex_);
+
+        // another thread might have registered it while we were waiting
+        if (const TypeID cached = detail::TypeIDCache<T>::Load(); cached.IsValid()) {
+            return cached;
+        }
+
+#ifndef REFLCPP_STABLE_TYPE_IDS
+        if (typeCount_ >= detail::ChunkedTable<const Type>::Capacity) {
             return rescpp::fail(ReflectError::MaxLimitReached);
         }
+#endif
 
         const TypeData* type_data;
         try {
@@ -58,21 +85,52 @@ public:
         catch (const std::exception&) {
             return rescpp::fail<ReflectError>(ReflectError::CreationFailed);
         }
-        const auto type_id = TypeID(types_.size() + 1);
+#ifdef REFLCPP_STABLE_TYPE_IDS
+        constexpr auto type_id = StableTypeID<T>();
+        if (lookup_.Contains(type_id.Value())) {
+            // hash of two different type names collided
+            return rescpp::fail(ReflectError::IDCollision);
+        }
+#else
+        const auto type_id = TypeID(typeCount_ + 1);
+#endif
 
-        TypeOptions type_options{};
+        TypeOptions type_options{
+            .layout = TypeLayout::Of<T>(),
+        };
 
         if constexpr (detail::HasReflectPrinter<T>) {
             type_options.printFunc = ReflectPrinter<T>::Print;
         }
 
+        // the arena never frees a type, so it is only created once it is sure to get stored
+        if (!lookup_.Reserve()) {
+            return rescpp::fail<ReflectError>(ReflectError::OutOfMemory);
+        }
+
+        const Type* type;
         try {
-            const auto& type = types_.emplace_back(std::make_unique<Type>(type_id, type_data, type_options));
-            return type->GetID();
+            type = arena_.Create<Type>(type_id, type_data, type_options);
         }
         catch (const std::exception&) {
             return rescpp::fail<ReflectError>(ReflectError::OutOfMemory);
         }
+#ifdef REFLCPP_STABLE_TYPE_IDS
+        lookup_.Insert(type_id.Value(), type);
+#else
+        lookup_.Append(type);
+#endif
+        ++typeCount_;
+
+        // published before the lock is released, so no other thread registers 'T' again
+        detail::TypeIDCache<T>::Store(type_id);
+        return type_id;
+    }
+
+    /// Memory taken by the types and the wrappers behind their fields and methods.
+    [[nodiscard]]
+    detail::ArenaStats GetMetadataStats() noexcept {
+        return arena_.GetStats();
     }
 
     [[nodiscard]]
@@ -81,11 +139,16 @@ public:
             return rescpp::fail(GetTypeError::InvalidID);
         }
 
-        if (id.Value() > types_.size()) {
+#ifdef REFLCPP_STABLE_TYPE_IDS
+        const Type* type = lookup_.Find(id.Value());
+#else
+        const Type* type = lookup_.Get(id.Value() - 1);
+#endif
+        if (!type) {
             return rescpp::fail(GetTypeError::NotFound);
         }
 
-        return *types_[id - 1];
+        return *type;
     }
 };
 }
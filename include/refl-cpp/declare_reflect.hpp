@@ -10,6 +10,10 @@ enum class ReflectError : uint8_t {
     MaxLimitReached,
     CreationFailed,
     OutOfMemory,
+    /// Only with 'REFLCPP_STABLE_TYPE_IDS', another type's name hashes to the same id.
+    /// Types of anonymous namespaces are named alike in every translation unit,
+    /// so two of them with the same name always collide.
+    IDCollision,
 };
 
 template <typename T>
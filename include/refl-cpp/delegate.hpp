@@ -0,0 +1,66 @@
+#pragma once
+
+#include <functional>
+
+#include "refl-cpp/common/type_traits.hpp"
+
+namespace ReflCpp {
+struct MethodFunc;
+
+template <typename Signature>
+struct Delegate;
+
+namespace detail {
+template <typename Signature>
+using SignatureTag = TypeTag<Signature>;
+
+/// A 'Delegate' with its signature erased.
+struct ErasedDelegate {
+    const void* signature;
+    const void* target;
+    void (*thunk)();
+};
+
+template <typename T, typename Signature>
+struct DelegateThunk;
+
+template <typename T, typename R, typename... Args>
+struct DelegateThunk<T, R(Args...)> {
+    static R Invoke(const void* target, Args... args) {
+        return std::invoke(*static_cast<const T*>(target), std::forward<Args>(args)...);
+    }
+};
+
+/// Erases a delegate calling the function pointer 'target' points to.
+template <typename Signature, typename T>
+ErasedDelegate MakeErasedDelegate(const T* target) noexcept {
+    return {
+        .signature = &SignatureTag<Signature>::ID,
+        .target = target,
+        .thunk = reinterpret_cast<void(*)()>(&DelegateThunk<T, Signature>::Invoke),
+    };
+}
+}
+
+/// Typed callable of a reflected function, calling it directly without any 'Variant' or result in between.
+/// Member functions take their object as first parameter, e.g. 'int(const Foo&, int)'.
+/// It refers to the function stored in the reflection data, which lives as long as the type does.
+template <typename R, typename... Args>
+struct Delegate<R(Args...)> {
+private:
+    using Thunk = R(*)(const void*, Args...);
+
+    const void* target_;
+    Thunk thunk_;
+
+    explicit Delegate(const detail::ErasedDelegate& erased) noexcept
+        : target_(erased.target), thunk_(reinterpret_cast<Thunk>(erased.thunk)) {}
+
+    friend struct MethodFunc;
+
+public:
+    R operator()(Args... args) const {
+        return thunk_(target_, std::forward<Args>(args)...);
+    }
+};
+}
@@ -1,23 +1,59 @@
 #pragma once
 
-#include <memory>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
 
+#include "refl-cpp/common/arena.hpp"
+#include "refl-cpp/common/type_traits.hpp"
+#include "refl-cpp/common/unconstructed_object.hpp"
 #include "refl-cpp/field_wrapper.hpp"
 #include "refl-cpp/field_data.hpp"
+#include "refl-cpp/field_accessor.hpp"
+#include "refl-cpp/type_layout.hpp"
 
 namespace ReflCpp {
+namespace detail {
+/// Byte offset of 'member' within 'C', only meaningful for standard layout classes.
+template <typename C, typename T>
+size_t MemberOffset(T C::* member) noexcept {
+    const auto* object = reinterpret_cast<const C*>(UnconstructedObject<C>());
+    return OffsetInUnconstructed<C>(std::addressof(object->*member));
+}
+}
+
 struct Field {
 private:
-    std::shared_ptr<FieldBase> base_;
+    // owned by the metadata arena, so copies of a field share it
+    const FieldBase* base_;
 
     const char* name_;
 
+    // layout, the offset is only known for non-static fields of standard layout classes
+    std::optional<size_t> offset_;
+    TypeLayout layout_;
+    const void* typeTag_;
+    const void* classTag_;
+    bool isConst_;
+    bool isStatic_;
+
 public:
     template <typename T>
     Field(const FieldData<T>& data)
-        : base_(std::make_shared<FieldWrapper<T>>(data.ptr)),
-          name_(data.name) {}
-    
+        : base_(detail::MetadataArena().Create<FieldWrapper<T>>(data.ptr)),
+          name_(data.name),
+          layout_(TypeLayout::Of<typename FieldTraits<T>::Type>()),
+          typeTag_(&detail::TypeTag<typename FieldTraits<T>::Type>::ID),
+          classTag_(&detail::TypeTag<typename FieldTraits<T>::ClassType>::ID),
+          isConst_(FieldTraits<T>::IsConst),
+          isStatic_(FieldTraits<T>::IsStatic) {
+        using Traits = FieldTraits<T>;
+        if constexpr (!Traits::IsStatic && std::is_standard_layout_v<typename Traits::ClassType>) {
+            offset_ = detail::MemberOffset(data.ptr);
+        }
+    }
+
     [[nodiscard]]
     const char* GetName() const {
         return name_;
@@ -54,5 +90,100 @@ public:
     rescpp::result<T&, FieldGetError> GetRef(const Variant& instance = Variant::Void()) const {
         return TRY(base_->GetRef(instance)).Get<T&>();
     }
+
+    /// Byte offset within an instance, only known for non-static fields of standard layout classes.
+    [[nodiscard]]
+    std::optional<size_t> GetOffset() const noexcept {
+        return offset_;
+    }
+
+    [[nodiscard]]
+    size_t GetSize() const noexcept {
+        return layout_.size;
+    }
+
+    /// Layout of the field type.
+    [[nodiscard]]
+    const TypeLayout& GetLayout() const noexcept {
+        return layout_;
+    }
+
+    /// Whether the field type is 'T', ignoring const.
+    template <typename T>
+    [[nodiscard]]
+    bool IsType() const noexcept {
+        return typeTag_ == &detail::TypeTag<std::remove_const_t<T>>::ID;
+    }
+
+    [[nodiscard]]
+    bool IsConst() const noexcept {
+        return isConst_;
+    }
+
+    [[nodiscard]]
+    bool IsStatic() const noexcept {
+        return isStatic_;
+    }
+
+    /// Address of the field within 'instance', which has to point to an object of its class.
+    /// Goes through the offset if it is known and the member pointer otherwise.
+    [[nodiscard]]
+    const void* AddressIn(const void* instance) const noexcept {
+        if (offset_.has_value()) {
+            return static_cast<const std::byte*>(instance) + *offset_;
+        }
+        return base_->GetAddressUnchecked(instance);
+    }
+
+    [[nodiscard]]
+    void* AddressIn(void* instance) const noexcept {
+        return const_cast<void*>(AddressIn(static_cast<const void*>(instance)));
+    }
+
+    /// Direct access without variants or virtual calls.
+    /// Empty if the offset is unknown or 'T' is not the field type, which has to be const for const fields.
+    template <typename T>
+    [[nodiscard]]
+    std::optional<FieldAccessor<T>> Accessor() const noexcept {
+        if (!offset_.has_value() || !IsType<T>() || (isConst_ && !std::is_const_v<T>)) {
+            return std::nullopt;
+        }
+        return FieldAccessor<T>(*offset_);
+    }
+
+    /// Copies the field of every instance into 'out', which needs the same size.
+    /// Works for every non-static field, not only the ones with a known offset.
+    template <typename Obj, typename T>
+    [[nodiscard]]
+    rescpp::result<void, FieldColumnError> Gather(std::span<Obj> instances, std::span<T> out) const noexcept
+        requires (!std::is_const_v<T>) {
+        TRY(CheckColumn<Obj, T>(instances.size(), out.size()));
+        return base_->GatherUnchecked(instances.data(), instances.size(), out.data());
+    }
+
+    /// Copies every value of 'in' into the field of the instance with the same index.
+    template <typename T, typename Obj>
+    [[nodiscard]]
+    rescpp::result<void, FieldColumnError> Scatter(std::span<T> in, std::span<Obj> instances) const noexcept
+        requires (!std::is_const_v<Obj>) {
+        TRY(CheckColumn<Obj, T>(instances.size(), in.size()));
+        return base_->ScatterUnchecked(in.data(), in.size(), instances.data());
+    }
+
+private:
+    template <typename Obj, typename T>
+    [[nodiscard]]
+    rescpp::result<void, FieldColumnError> CheckColumn(const size_t instances, const size_t values) const noexcept {
+        if (classTag_ != &detail::TypeTag<std::remove_const_t<Obj>>::ID) {
+            return rescpp::fail(FieldColumnError::ClassMismatch);
+        }
+        if (!IsType<T>()) {
+            return rescpp::fail(FieldColumnError::TypeMismatch);
+        }
+        if (instances != values) {
+            return rescpp::fail(FieldColumnError::SizeMismatch);
+        }
+        return {};
+    }
 };
 }
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ReflCpp {
+/// Reads and writes a field of type 'T' directly at its offset within an instance.
+/// There are no checks, 'instance' has to point to an object of the class the field belongs to.
+template <typename T>
+struct FieldAccessor {
+private:
+    size_t offset_;
+
+public:
+    explicit constexpr FieldAccessor(const size_t offset) noexcept
+        : offset_(offset) {}
+
+    [[nodiscard]]
+    size_t GetOffset() const noexcept {
+        return offset_;
+    }
+
+    [[nodiscard]]
+    T& Ref(void* instance) const noexcept {
+        return *reinterpret_cast<T*>(static_cast<std::byte*>(instance) + offset_);
+    }
+
+    [[nodiscard]]
+    const T& Get(const void* instance) const noexcept {
+        return *reinterpret_cast<const T*>(static_cast<const std::byte*>(instance) + offset_);
+    }
+
+    void Set(void* instance, const T& value) const
+        requires (!std::is_const_v<T> && std::is_copy_assignable_v<T>) {
+        Ref(instance) = value;
+    }
+};
+}
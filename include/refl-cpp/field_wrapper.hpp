@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstring>
+#include <exception>
+#include <memory>
+
 #include "common/unreachable.hpp"
 #include "refl-cpp/common/type_traits.hpp"
 #include "refl-cpp/variant.hpp"
@@ -14,6 +18,7 @@ enum class FieldGetError : uint8_t {
 
     ReflectMaxLimitReached,
     ReflectCreationFailed,
+    ReflectIDCollision,
 
     OutOfMemory,
 };
@@ -42,6 +47,8 @@ struct ::rescpp::type_converter<ReflCpp::ReflectError, ReflCpp::FieldGetError> {
                 return ReflCpp::FieldGetError::ReflectCreationFailed;
             case ReflCpp::ReflectError::OutOfMemory:
                 return ReflCpp::FieldGetError::OutOfMemory;
+            case ReflCpp::ReflectError::IDCollision:
+                return ReflCpp::FieldGetError::ReflectIDCollision;
         }
         ReflCpp::unreachable<true>();
     }
@@ -72,6 +79,18 @@ struct ::rescpp::type_converter<ReflCpp::VariantGetError, ReflCpp::FieldSetError
 };
 
 namespace ReflCpp {
+enum class FieldColumnError : uint8_t {
+    IsStatic,
+    IsConst,
+    IsNotCopyAssignable,
+    /// Copying a value threw, the values before it are already copied.
+    OutOfMemory,
+
+    ClassMismatch,
+    TypeMismatch,
+    SizeMismatch,
+};
+
 struct FieldBase {
     virtual ~FieldBase() = default;
 
@@ -92,6 +111,21 @@ struct FieldBase {
 
     [[nodiscard]]
     virtual rescpp::result<Variant, FieldGetError> GetRef(const Variant& instance) const = 0;
+
+    /// Address of the field within 'instance', which has to point to an object of the class.
+    /// Static fields ignore 'instance'.
+    [[nodiscard]]
+    virtual const void* GetAddressUnchecked(const void* instance) const noexcept = 0;
+
+    /// Copies the field of 'count' contiguous instances into 'out'.
+    /// Both have to be arrays of the class and field type.
+    [[nodiscard]]
+    virtual rescpp::result<void, FieldColumnError> GatherUnchecked(const void* instances, size_t count, void* out) const = 0;
+
+    /// Copies 'count' values of 'in' into the field of contiguous instances.
+    /// Both have to be arrays of the field and class type.
+    [[nodiscard]]
+    virtual rescpp::result<void, FieldColumnError> ScatterUnchecked(const void* in, size_t count, void* instances) const = 0;
 };
 
 template <typename T>
@@ -179,5 +213,92 @@ public:
             return Variant::Create<return_type>(static_cast<return_type>(obj.*ptr_));
         }
     }
+
+    [[nodiscard]]
+    const void* GetAddressUnchecked(const void* instance) const noexcept override {
+        if constexpr (Traits::IsStatic) {
+            return ptr_;
+        }
+        else {
+            return std::addressof(static_cast<const typename Traits::ClassType*>(instance)->*ptr_);
+        }
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, FieldColumnError> GatherUnchecked(const void* instances, const size_t count, void* out) const noexcept override {
+        if constexpr (Traits::IsStatic) {
+            return rescpp::fail(FieldColumnError::IsStatic);
+        }
+        else if constexpr (!std::is_copy_assignable_v<typename Traits::Type>) {
+            return rescpp::fail(FieldColumnError::IsNotCopyAssignable);
+        }
+        else {
+            using ClassType = typename Traits::ClassType;
+            using Type = typename Traits::Type;
+
+            const auto* objects = static_cast<const ClassType*>(instances);
+            auto* values = static_cast<Type*>(out);
+            if constexpr (std::is_trivially_copyable_v<ClassType> && sizeof(ClassType) == sizeof(Type)) {
+                // the field is all there is, so the column is already contiguous
+                std::memcpy(static_cast<void*>(values), static_cast<const void*>(objects), count * sizeof(Type));
+            }
+            else if constexpr (std::is_nothrow_copy_assignable_v<Type>) {
+                // plain strided loop, which the compiler can vectorize for trivial types
+                for (size_t i = 0; i < count; ++i) {
+                    values[i] = objects[i].*ptr_;
+                }
+            }
+            else {
+                try {
+                    for (size_t i = 0; i < count; ++i) {
+                        values[i] = objects[i].*ptr_;
+                    }
+                }
+                catch (const std::exception&) {
+                    return rescpp::fail(FieldColumnError::OutOfMemory);
+                }
+            }
+            return {};
+        }
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, FieldColumnError> ScatterUnchecked(const void* in, const size_t count, void* instances) const noexcept override {
+        if constexpr (Traits::IsStatic) {
+            return rescpp::fail(FieldColumnError::IsStatic);
+        }
+        else if constexpr (Traits::IsConst) {
+            return rescpp::fail(FieldColumnError::IsConst);
+        }
+        else if constexpr (!std::is_copy_assignable_v<typename Traits::Type>) {
+            return rescpp::fail(FieldColumnError::IsNotCopyAssignable);
+        }
+        else {
+            using ClassType = typename Traits::ClassType;
+            using Type = typename Traits::Type;
+
+            const auto* values = static_cast<const Type*>(in);
+            auto* objects = static_cast<ClassType*>(instances);
+            if constexpr (std::is_trivially_copyable_v<ClassType> && sizeof(ClassType) == sizeof(Type)) {
+                std::memcpy(static_cast<void*>(objects), static_cast<const void*>(values), count * sizeof(Type));
+            }
+            else if constexpr (std::is_nothrow_copy_assignable_v<Type>) {
+                for (size_t i = 0; i < count; ++i) {
+                    objects[i].*ptr_ = values[i];
+                }
+            }
+            else {
+                try {
+                    for (size_t i = 0; i < count; ++i) {
+                        objects[i].*ptr_ = values[i];
+                    }
+                }
+                catch (const std::exception&) {
+                    return rescpp::fail(FieldColumnError::OutOfMemory);
+                }
+            }
+            return {};
+        }
+    }
 };
 }
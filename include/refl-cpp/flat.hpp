@@ -0,0 +1,400 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#ifdef _WIN32
+// keep the min and max macros and the rarely used parts of the Win32 headers out of every includer
+#ifndef NOMINMAX
+#define NOMINMAX
+#define REFLCPP_UNDEF_NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define REFLCPP_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#ifdef REFLCPP_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef REFLCPP_UNDEF_NOMINMAX
+#endif
+#ifdef REFLCPP_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef REFLCPP_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "refl-cpp/reflect.hpp"
+#include "refl-cpp/type_plan_cache.hpp"
+#include "refl-cpp/common/name_index.hpp"
+#include "refl-cpp/common/unreachable.hpp"
+
+namespace ReflCpp {
+enum class FlatError : uint8_t {
+    /// The type is not trivially copyable, holds pointers or has fields without a known offset.
+    Unsupported,
+    WriteFailed,
+    OpenFailed,
+    MapFailed,
+
+    TooSmall,
+    BadMagic,
+    VersionMismatch,
+    ByteOrderMismatch,
+    FingerprintMismatch,
+    SizeMismatch,
+    Misaligned,
+
+    TypeNotFound,
+
+    ReflectMaxLimitReached,
+    ReflectCreationFailed,
+    ReflectIDCollision,
+
+    OutOfMemory,
+};
+}
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::ReflectError, ReflCpp::FlatError> {
+    static ReflCpp::FlatError convert(const ReflCpp::ReflectError& error) noexcept {
+        switch (error) {
+            case ReflCpp::ReflectError::MaxLimitReached:
+                return ReflCpp::FlatError::ReflectMaxLimitReached;
+            case ReflCpp::ReflectError::CreationFailed:
+                return ReflCpp::FlatError::ReflectCreationFailed;
+            case ReflCpp::ReflectError::OutOfMemory:
+                return ReflCpp::FlatError::OutOfMemory;
+            case ReflCpp::ReflectError::IDCollision:
+                return ReflCpp::FlatError::ReflectIDCollision;
+        }
+        ReflCpp::unreachable<true>();
+    }
+};
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::GetTypeError, ReflCpp::FlatError> {
+    static ReflCpp::FlatError convert(const ReflCpp::GetTypeError&) noexcept {
+        return ReflCpp::FlatError::TypeNotFound;
+    }
+};
+
+namespace ReflCpp {
+/// Start of every flat file, followed by the objects at 'dataOffset'.
+struct FlatHeader {
+    static constexpr char Magic[8] = { 'R', 'E', 'F', 'L', 'F', 'L', 'A', 'T' };
+    static constexpr uint32_t CurrentVersion = 1;
+    static constexpr uint32_t ByteOrderMark = 0x01020304;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t fingerprint;
+    uint64_t elementSize;
+    uint64_t alignment;
+    uint64_t count;
+    uint64_t dataOffset;
+    uint64_t reserved;
+};
+
+static_assert(sizeof(FlatHeader) == 64);
+
+/// Whether and how objects of a type can be stored flat, built once per type.
+struct FlatPlan {
+    /// Combines the fingerprint of the type with its size, alignment and the offset of every field,
+    /// so two programs agree on it only if they lay the objects out the same way.
+    uint64_t fingerprint = 0;
+    size_t size = 0;
+    size_t alignment = 0;
+
+    template <typename Cache>
+    [[nodiscard]]
+    static rescpp::result<void, FlatError> Build(Cache& cache, const Type& type, FlatPlan& plan) noexcept {
+        const TypeLayout& layout = type.GetLayout();
+        if (!layout.triviallyCopyable || type.GetFlags().Has(TypeFlags::IsPointer)) {
+            return rescpp::fail(FlatError::Unsupported);
+        }
+
+        plan.size = layout.size;
+        plan.alignment = layout.alignment;
+
+        const uint64_t type_fingerprint = type.GetFingerprint();
+        if (type_fingerprint == 0) {
+            return rescpp::fail(FlatError::ReflectCreationFailed);
+        }
+
+        uint64_t hash = detail::CombineHash(type_fingerprint, layout.size);
+        hash = detail::CombineHash(hash, layout.alignment);
+
+        for (const Field& field : type.GetFields()) {
+            if (field.IsStatic()) {
+                continue;
+            }
+
+            const std::optional<size_t> offset = field.GetOffset();
+            if (!offset.has_value()) {
+                return rescpp::fail(FlatError::Unsupported);
+            }
+
+            const Type& field_type = TRY(detail::Reflect(TRY(field.GetType())));
+            const FlatPlan& field_plan = TRY(cache.GetLocked(field_type));
+
+            hash = detail::CombineHash(hash, *offset);
+            hash = detail::CombineHash(hash, field_plan.fingerprint);
+        }
+
+        plan.fingerprint = hash;
+        return {};
+    }
+};
+
+namespace detail {
+using FlatPlanCache = TypePlanCache<FlatPlan, FlatError>;
+
+constexpr uint64_t AlignUp(const uint64_t value, const uint64_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+}
+
+/// Writes 'count' contiguous objects of 'type' after a header, so they can be mapped and read in place.
+/// Only trivially copyable, standard layout types without pointers are supported.
+[[nodiscard]]
+inline rescpp::result<void, FlatError> WriteFlat(const Type& type, const void* objects, const size_t count, std::ostream& out) noexcept {
+    const FlatPlan& plan = TRY(detail::FlatPlanCache::Instance().Get(type));
+
+    FlatHeader header{};
+    std::memcpy(header.magic, FlatHeader::Magic, sizeof(header.magic));
+    header.version = FlatHeader::CurrentVersion;
+    header.byteOrder = FlatHeader::ByteOrderMark;
+    header.fingerprint = plan.fingerprint;
+    header.elementSize = plan.size;
+    header.alignment = plan.alignment;
+    header.count = count;
+    header.dataOffset = detail::AlignUp(sizeof(FlatHeader), plan.alignment);
+
+    try {
+        static constexpr char Padding[64]{};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (size_t padding = header.dataOffset - sizeof(header); padding > 0;) {
+            const size_t chunk = (std::min)(padding, sizeof(Padding));
+            out.write(Padding, static_cast<std::streamsize>(chunk));
+            padding -= chunk;
+        }
+        out.write(static_cast<const char*>(objects), static_cast<std::streamsize>(count * plan.size));
+    }
+    catch (const std::exception&) {
+        return rescpp::fail(FlatError::WriteFailed);
+    }
+    if (!out) {
+        return rescpp::fail(FlatError::WriteFailed);
+    }
+    return {};
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<void, FlatError> WriteFlat(std::span<const T> objects, std::ostream& out) noexcept {
+    return WriteFlat(TRY(Reflect<T>()), objects.data(), objects.size(), out);
+}
+
+/// Checks the header in 'bytes' once and returns the objects following it, without copying them.
+/// 'bytes' has to be aligned for 'type', which memory mapped files always are.
+[[nodiscard]]
+inline rescpp::result<std::span<const std::byte>, FlatError> OpenFlat(const Type& type, const std::span<const std::byte> bytes) noexcept {
+    const FlatPlan& plan = TRY(detail::FlatPlanCache::Instance().Get(type));
+
+    if (bytes.size() < sizeof(FlatHeader)) {
+        return rescpp::fail(FlatError::TooSmall);
+    }
+    FlatHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, FlatHeader::Magic, sizeof(header.magic)) != 0) {
+        return rescpp::fail(FlatError::BadMagic);
+    }
+    if (header.version != FlatHeader::CurrentVersion) {
+        return rescpp::fail(FlatError::VersionMismatch);
+    }
+    if (header.byteOrder != FlatHeader::ByteOrderMark) {
+        return rescpp::fail(FlatError::ByteOrderMismatch);
+    }
+    if (header.fingerprint != plan.fingerprint || header.elementSize != plan.size || header.alignment != plan.alignment) {
+        return rescpp::fail(FlatError::FingerprintMismatch);
+    }
+    if (header.dataOffset > bytes.size() || header.count > (bytes.size() - header.dataOffset) / plan.size) {
+        return rescpp::fail(FlatError::SizeMismatch);
+    }
+
+    const std::byte* data = bytes.data() + header.dataOffset;
+    if (reinterpret_cast<uintptr_t>(data) % plan.alignment != 0) {
+        return rescpp::fail(FlatError::Misaligned);
+    }
+    return std::span<const std::byte>(data, header.count * plan.size);
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<std::span<const T>, FlatError> OpenFlat(const std::span<const std::byte> bytes) noexcept {
+    const std::span<const std::byte> data = TRY(OpenFlat(TRY(Reflect<T>()), bytes));
+    return std::span<const T>(reinterpret_cast<const T*>(data.data()), data.size() / sizeof(T));
+}
+
+/// Read only mapping of a whole file, unmapped on destruction.
+struct MappedFile {
+private:
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+
+    void Close() noexcept {
+#ifdef _WIN32
+        if (data_) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+        file_ = INVALID_HANDLE_VALUE;
+        mapping_ = nullptr;
+#else
+        if (data_ && size_ > 0) {
+            munmap(const_cast<std::byte*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+public:
+    MappedFile() noexcept = default;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+            file_ = std::exchange(other.file_, INVALID_HANDLE_VALUE);
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    ~MappedFile() {
+        Close();
+    }
+
+    [[nodiscard]]
+    static rescpp::result<MappedFile, FlatError> Open(const char* path) noexcept {
+        MappedFile file;
+#ifdef _WIN32
+        file.file_ = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file.file_ == INVALID_HANDLE_VALUE) {
+            return rescpp::fail(FlatError::OpenFailed);
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file.file_, &size)) {
+            return rescpp::fail(FlatError::OpenFailed);
+        }
+        file.size_ = static_cast<size_t>(size.QuadPart);
+        if (file.size_ == 0) {
+            return file;
+        }
+
+        file.mapping_ = CreateFileMappingA(file.file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!file.mapping_) {
+            return rescpp::fail(FlatError::MapFailed);
+        }
+        file.data_ = static_cast<const std::byte*>(MapViewOfFile(file.mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (!file.data_) {
+            return rescpp::fail(FlatError::MapFailed);
+        }
+#else
+        const int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return rescpp::fail(FlatError::OpenFailed);
+        }
+
+        struct stat info{};
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            return rescpp::fail(FlatError::OpenFailed);
+        }
+        file.size_ = static_cast<size_t>(info.st_size);
+        if (file.size_ == 0) {
+            close(fd);
+            return file;
+        }
+
+        void* data = mmap(nullptr, file.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping keeps the file alive on its own
+        close(fd);
+        if (data == MAP_FAILED) {
+            file.size_ = 0;
+            return rescpp::fail(FlatError::MapFailed);
+        }
+        file.data_ = static_cast<const std::byte*>(data);
+#endif
+        return file;
+    }
+
+    [[nodiscard]]
+    std::span<const std::byte> Bytes() const noexcept {
+        return { data_, size_ };
+    }
+};
+
+/// Objects of a flat file, read in place from its mapping.
+template <typename T>
+struct FlatFile {
+private:
+    MappedFile file_;
+    std::span<const T> objects_;
+
+    FlatFile(MappedFile&& file, const std::span<const T> objects) noexcept
+        : file_(std::move(file)),
+          objects_(objects) {}
+
+public:
+    [[nodiscard]]
+    static rescpp::result<FlatFile, FlatError> Open(const char* path) noexcept {
+        auto file = MappedFile::Open(path);
+        if (file.has_error()) {
+            return rescpp::fail(file.error());
+        }
+        const std::span<const T> objects = TRY(OpenFlat<T>(file.value().Bytes()));
+        return FlatFile(std::move(file.value()), objects);
+    }
+
+    [[nodiscard]]
+    std::span<const T> Objects() const noexcept {
+        return objects_;
+    }
+};
+}
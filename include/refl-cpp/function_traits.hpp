@@ -9,6 +9,22 @@ template <typename T>
 struct FunctionTraits;
 
 namespace detail {
+/// Plain function type a function can be called as,
+/// member functions take their object as first parameter.
+template <bool IsStatic_, bool IsConst_, bool HasRReferenceObject_, typename C, typename R, typename... Args_>
+struct FunctionSignature {
+    using Type = R(Args_...);
+};
+
+template <bool IsConst_, bool HasRReferenceObject_, typename C, typename R, typename... Args_>
+struct FunctionSignature<false, IsConst_, HasRReferenceObject_, C, R, Args_...> {
+private:
+    using Object = std::conditional_t<IsConst_, const C, C>;
+
+public:
+    using Type = R(std::conditional_t<HasRReferenceObject_, Object&&, Object&>, Args_...);
+};
+
 template <bool IsStatic_, bool IsConst_, bool HasLReferenceObject_, bool HasRReferenceObject_, typename C, typename R, typename... Args_>
 struct FunctionTraitsBase {
 private:
@@ -55,6 +71,8 @@ public:
 
     static constexpr uint8_t ArgCount = m_ArgCount;
 
+    using Signature = typename FunctionSignature<IsStatic_, IsConst_, HasRReferenceObject_, C, R, Args_...>::Type;
+
     template <uint8_t I>
     struct Arg {
         using Type = std::tuple_element_t<I, std::tuple<Args_...>>;
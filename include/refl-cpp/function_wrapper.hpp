@@ -1,10 +1,19 @@
 #pragma once
 
 #include <array>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "refl-cpp/variant.hpp"
 #include "refl-cpp/argument.hpp"
+#include "refl-cpp/argument_signature.hpp"
 #include "refl-cpp/function_traits.hpp"
+#include "refl-cpp/delegate.hpp"
 
 namespace ReflCpp {
 struct FunctionWrapperArgumentError {
@@ -24,9 +33,13 @@ struct FunctionWrapperInvokeError {
 
         MaxReflectLimitReached,
         ReflectTypeCreationFailed,
+        ReflectTypeIDCollision,
         OutOfMemory,
 
         NoCompatibleFunctionFound,
+        IncompatibleReturnSlot,
+        /// A batch would have to pass a move only argument to an rvalue reference parameter more than once.
+        ArgumentNotCopyable,
     };
 
     Type type;
@@ -51,20 +64,75 @@ struct FunctionWrapperInvokeError {
             case ReflectError::OutOfMemory:
                 type = Type::OutOfMemory;
                 break;
+            case ReflectError::IDCollision:
+                type = Type::ReflectTypeIDCollision;
+                break;
         }
     }
 };
 
+/// Error of a batch invoke together with the index of the object it happened for.
+struct FunctionWrapperBatchError {
+    /// Index of errors which do not belong to any object, like finding no compatible function.
+    static constexpr size_t NoIndex = static_cast<size_t>(-1);
+
+    FunctionWrapperInvokeError error;
+    size_t index;
+
+    inline constexpr FunctionWrapperBatchError(const FunctionWrapperInvokeError& error, const size_t index = NoIndex) noexcept
+        : error(error), index(index) {}
+
+    inline constexpr FunctionWrapperBatchError(const FunctionWrapperInvokeError::Type type) noexcept
+        : error(type), index(NoIndex) {}
+
+    inline constexpr FunctionWrapperBatchError(const ReflectError reflect_error) noexcept
+        : error(reflect_error), index(NoIndex) {}
+};
+
+namespace detail {
+template <typename Traits, bool IsStatic = Traits::IsStatic>
+struct FunctionObjectType {
+    using Type = void;
+    using RValueType = void;
+};
+
+template <typename Traits>
+struct FunctionObjectType<Traits, false> {
+    using ClassT = std::conditional_t<Traits::IsConst, const typename Traits::ClassType, typename Traits::ClassType>;
+    using Type = std::conditional_t<Traits::HasRReferenceObject, ClassT&&, ClassT&>;
+    using RValueType = ClassT&&;
+};
+
+/// Whether 'slot' holds storage of the caller, which is written through instead of replaced.
+[[nodiscard]]
+inline bool IsReferenceSlot(const Variant& slot) noexcept {
+    const auto wrapper = slot.GetWrapperType();
+    return wrapper != VariantWrapperType::VOID
+        && wrapper != VariantWrapperType::VALUE
+        && wrapper != VariantWrapperType::CONST_VALUE;
+}
+}
+
 template <typename T>
 struct FunctionWrapper {
 private:
     using Traits = FunctionTraits<T>;
+    using ObjectType = typename detail::FunctionObjectType<Traits>::Type;
+    using RValueObjectType = typename detail::FunctionObjectType<Traits>::RValueType;
+    // methods without a reference qualifier can be called on temporaries too, like in a native call
+    static constexpr bool TakesRValueObject = !Traits::IsStatic && !Traits::HasReferenceObject;
     T ptr_;
 
+    /// What argument 'Index' is gotten out of its variant as, and checked against.
+    /// By-value parameters only need to read their argument to copy it,
+    /// so const values and temporaries can be passed to them like in a native call.
+    template <size_t Index, typename A = typename Traits::template Arg<Index>::Type>
+    using ArgGetType = std::conditional_t<std::is_reference_v<A> || std::is_pointer_v<A>, A, const A>;
+
     template <size_t First, size_t... Rest>
     [[nodiscard]]
-    rescpp::result<void, FunctionWrapperArgumentError> CheckArgsImpl(const ArgumentList& args) const noexcept {
-        RESCPP_TRY_IMPL(args[First].CheckGet<typename Traits::template Arg<First>::Type>(), {
+    rescpp::result<void, FunctionWrapperArgumentError> CheckArgsImpl(const ArgumentSpan args) const noexcept {
+        RESCPP_TRY_IMPL(args[First].CheckGet<ArgGetType<First>>(), {
                         return rescpp::fail<FunctionWrapperArgumentError>(result_.error(), First);
                         });
 
@@ -78,7 +146,7 @@ private:
 
     template <size_t... Indices>
     [[nodiscard]]
-    rescpp::result<void, FunctionWrapperArgumentError> CheckArgs(const ArgumentList& args) const {
+    rescpp::result<void, FunctionWrapperArgumentError> CheckArgs(const ArgumentSpan args) const {
         if constexpr (sizeof...(Indices) == 0) {
             return {};
         }
@@ -89,33 +157,28 @@ private:
 
     template <size_t... Indices>
     [[nodiscard]]
-    rescpp::result<void, FunctionWrapperArgumentError> CheckArgs(const ArgumentList& args, std::index_sequence<Indices...>) const {
+    rescpp::result<void, FunctionWrapperArgumentError> CheckArgs(const ArgumentSpan args, std::index_sequence<Indices...>) const {
         return CheckArgs<Indices...>(args);
     }
 
     [[nodiscard]]
-    rescpp::result<void, FunctionWrapperArgumentError> CheckArgs(const ArgumentList& args) const noexcept {
+    rescpp::result<void, FunctionWrapperArgumentError> CheckArgs(const ArgumentSpan args) const noexcept {
         return CheckArgs(args, std::make_index_sequence<Traits::ArgCount>{});
     }
 
-#define REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS() \
-    TRY(CheckArgs<Indices...>(args))
+    template <size_t... Indices>
+    [[nodiscard]]
+    static bool CanInvokeWithImpl(const ArgumentSignature& signature, std::index_sequence<Indices...>) noexcept {
+        return (Variant::CanGet<ArgGetType<Indices>>(signature[Indices].type, signature[Indices].wrapper) && ...);
+    }
 
+// arguments are expected to be checked already, see 'InvokeUnchecked'
 #define REFLCPP_FUNCTION_WRAPPER_GET_ARGS() \
-    args[Indices].template Get<std::conditional_t< \
-        std::is_pointer_v<typename Traits::template Arg<Indices>::Type>, \
-        typename Traits::template Arg<Indices>::Type, \
-        std::conditional_t<std::is_reference_v<typename Traits::template Arg<Indices>::Type>, \
-            typename Traits::template Arg<Indices>::Type, \
-            typename Traits::template Arg<Indices>::Type& \
-        > \
-    >>().value()...
+    args[Indices].template GetUnchecked<ArgGetType<Indices>>()...
 
     template <size_t... Indices>
         requires (Traits::IsStatic && Traits::HasReturn)
-    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeImpl(const ArgumentList& args, std::index_sequence<Indices...>) const {
-        REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS();
-
+    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeImpl(const ArgumentSpan args, std::index_sequence<Indices...>) const {
         return Variant::Create<typename Traits::ReturnType>(
             (ptr_)(REFLCPP_FUNCTION_WRAPPER_GET_ARGS())
         );
@@ -123,9 +186,7 @@ private:
 
     template <size_t... Indices>
         requires (Traits::IsStatic && !Traits::HasReturn)
-    rescpp::result<void, FunctionWrapperInvokeError> InvokeImpl(const ArgumentList& args, std::index_sequence<Indices...>) const {
-        REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS();
-        
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeImpl(const ArgumentSpan args, std::index_sequence<Indices...>) const {
         (ptr_)(
             REFLCPP_FUNCTION_WRAPPER_GET_ARGS()
         );
@@ -135,30 +196,26 @@ private:
 
     template <size_t... Indices>
         requires (!Traits::IsStatic && !Traits::HasRReferenceObject && Traits::HasReturn)
-    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeImpl(const ArgumentList& args, std::index_sequence<Indices...>, const Variant& obj) const {
-        REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS();
-        
+    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeImpl(const ArgumentSpan args, std::index_sequence<Indices...>, const Variant& obj) const {
         using ClassT_ = std::conditional_t<Traits::IsConst, const typename Traits::ClassType&, typename Traits::ClassType&>;
         if (!obj.CanGet<ClassT_>()) {
             return rescpp::fail(FunctionWrapperInvokeError::Type::ObjectIsInvalid);
         }
 
         return Variant::Create<typename Traits::ReturnType>(
-            (obj.Get<ClassT_>().value().*ptr_)(REFLCPP_FUNCTION_WRAPPER_GET_ARGS())
+            (obj.GetUnchecked<ClassT_>().*ptr_)(REFLCPP_FUNCTION_WRAPPER_GET_ARGS())
         );
     }
 
     template <size_t... Indices>
         requires (!Traits::IsStatic && !Traits::HasRReferenceObject && !Traits::HasReturn)
-    rescpp::result<void, FunctionWrapperInvokeError> InvokeImpl(const ArgumentList& args, std::index_sequence<Indices...>, const Variant& obj) const {
-        REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS();
-        
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeImpl(const ArgumentSpan args, std::index_sequence<Indices...>, const Variant& obj) const {
         using ClassT_ = std::conditional_t<Traits::IsConst, const typename Traits::ClassType&, typename Traits::ClassType&>;
         if (!obj.CanGet<ClassT_>()) {
             return rescpp::fail(FunctionWrapperInvokeError::Type::ObjectIsInvalid);
         }
 
-        (obj.Get<ClassT_>().value().*ptr_)(
+        (obj.GetUnchecked<ClassT_>().*ptr_)(
             REFLCPP_FUNCTION_WRAPPER_GET_ARGS()
         );
 
@@ -167,38 +224,201 @@ private:
 
     template <size_t... Indices>
         requires (!Traits::IsStatic && Traits::HasRReferenceObject && Traits::HasReturn)
-    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeImpl(const ArgumentList& args, std::index_sequence<Indices...>, const Variant& obj) const {
-        REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS();
-        
+    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeImpl(const ArgumentSpan args, std::index_sequence<Indices...>, const Variant& obj) const {
         using ClassT_ = std::conditional_t<Traits::IsConst, const typename Traits::ClassType&&, typename Traits::ClassType&&>;
         if (!obj.CanGet<ClassT_>()) {
             return rescpp::fail(FunctionWrapperInvokeError::Type::ObjectIsInvalid);
         }
 
         return Variant::Create<typename Traits::ReturnType>(
-            (std::move(obj.Get<ClassT_>().value()).*ptr_)(REFLCPP_FUNCTION_WRAPPER_GET_ARGS())
+            (std::move(obj.GetUnchecked<ClassT_>()).*ptr_)(REFLCPP_FUNCTION_WRAPPER_GET_ARGS())
         );
     }
 
     template <size_t... Indices>
         requires (!Traits::IsStatic && Traits::HasRReferenceObject && !Traits::HasReturn)
-    rescpp::result<void, FunctionWrapperInvokeError> InvokeImpl(const ArgumentList& args, std::index_sequence<Indices...>, const Variant& obj) const {
-        REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS();
-        
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeImpl(const ArgumentSpan args, std::index_sequence<Indices...>, const Variant& obj) const {
         using ClassT_ = std::conditional_t<Traits::IsConst, const typename Traits::ClassType&&, typename Traits::ClassType&&>;
         if (!obj.CanGet<ClassT_>()) {
             return rescpp::fail(FunctionWrapperInvokeError::Type::ObjectIsInvalid);
         }
 
-        (std::move(obj.Get<ClassT_>().value()).*ptr_)(
+        (std::move(obj.GetUnchecked<ClassT_>()).*ptr_)(
             REFLCPP_FUNCTION_WRAPPER_GET_ARGS()
         );
 
         return {};
     }
 
+    [[nodiscard]]
+    static rescpp::result<void, FunctionWrapperInvokeError> CheckObject(const Variant& obj) noexcept {
+        if constexpr (!Traits::IsStatic) {
+            if (obj.IsVoid()) {
+                return rescpp::fail(FunctionWrapperInvokeError::Type::ObjectIsVoid);
+            }
+            if (!obj.CanGet<ObjectType>()) {
+                if constexpr (TakesRValueObject) {
+                    if (obj.CanGet<RValueObjectType>()) {
+                        return {};
+                    }
+                }
+                return rescpp::fail(FunctionWrapperInvokeError::Type::ObjectIsInvalid);
+            }
+        }
+        return {};
+    }
+
+    /// Address of the object in 'obj', expects 'CheckObject(obj)' to have passed.
+    [[nodiscard]]
+    static void* ObjectAddress(const Variant& obj) noexcept {
+        if constexpr (Traits::IsStatic) {
+            return nullptr;
+        }
+        else {
+            if constexpr (TakesRValueObject) {
+                if (!obj.CanGet<ObjectType>()) {
+                    auto&& object = obj.GetUnchecked<RValueObjectType>();
+                    return const_cast<void*>(static_cast<const void*>(std::addressof(object)));
+                }
+            }
+            auto&& object = obj.GetUnchecked<ObjectType>();
+            return const_cast<void*>(static_cast<const void*>(std::addressof(object)));
+        }
+    }
+
+    /// Arguments gotten out of their variants once, so they can be passed to several calls.
+    template <typename Indices = std::make_index_sequence<Traits::ArgCount>>
+    struct ExtractedArgsImpl;
+
+    template <size_t... Indices>
+    struct ExtractedArgsImpl<std::index_sequence<Indices...>> {
+        using Type = std::tuple<detail::VariantGetResult<ArgGetType<Indices>>...>;
+    };
+
+    using ExtractedArgs = typename ExtractedArgsImpl<>::Type;
+
+    template <size_t... Indices>
+    [[nodiscard]]
+    static ExtractedArgs ExtractArgs(const ArgumentSpan args, std::index_sequence<Indices...>) noexcept {
+        return ExtractedArgs(REFLCPP_FUNCTION_WRAPPER_GET_ARGS());
+    }
+
+    [[nodiscard]]
+    static ExtractedArgs ExtractArgs(const ArgumentSpan args) noexcept {
+        return ExtractArgs(args, std::make_index_sequence<Traits::ArgCount>());
+    }
+
+    /// Whether every rvalue reference parameter can be given a copy of its own, see 'PassArg'.
+    static constexpr bool ArgsReusable = []<typename... Args>(std::type_identity<std::tuple<Args...>>) {
+        return ((!std::is_rvalue_reference_v<Args> || std::is_copy_constructible_v<std::remove_cvref_t<Args>>) && ...);
+    }(std::type_identity<ExtractedArgs>());
+
+    /// Argument 'Index' as it is passed to the function. Arguments 'Reused' for several calls are passed
+    /// as lvalues, except to rvalue reference parameters, which get a copy of their own,
+    /// so no call sees what an earlier one moved from.
+    template <bool Reused, size_t Index>
+    static decltype(auto) PassArg(ExtractedArgs& args) {
+        using ArgT = std::tuple_element_t<Index, ExtractedArgs>;
+        if constexpr (!Reused) {
+            return std::forward<ArgT>(std::get<Index>(args));
+        }
+        else if constexpr (std::is_rvalue_reference_v<ArgT>) {
+            return std::remove_cvref_t<ArgT>(std::as_const(std::get<Index>(args)));
+        }
+        else {
+            return std::get<Index>(args);
+        }
+    }
+
+    /// Calls the function on 'object' and hands out its result as it is.
+    template <bool Reused, size_t... Indices>
+    decltype(auto) Call(ExtractedArgs& args, void* object, std::index_sequence<Indices...>) const {
+        if constexpr (Traits::IsStatic) {
+            return (ptr_)(PassArg<Reused, Indices>(args)...);
+        }
+        else {
+            auto& instance = *static_cast<std::remove_reference_t<ObjectType>*>(object);
+            if constexpr (Traits::HasRReferenceObject) {
+                return (std::move(instance).*ptr_)(PassArg<Reused, Indices>(args)...);
+            }
+            else {
+                return (instance.*ptr_)(PassArg<Reused, Indices>(args)...);
+            }
+        }
+    }
+
+    template <bool Reused = false>
+    decltype(auto) Call(ExtractedArgs& args, void* object) const {
+        return Call<Reused>(args, object, std::make_index_sequence<Traits::ArgCount>());
+    }
+
+    /// Calls the function on 'object' and writes the result into 'slot', see 'InvokeUncheckedInto'.
+    template <bool Reused = false>
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> CallInto(ExtractedArgs& args, void* object, Variant& slot) const {
+        if constexpr (!Traits::HasReturn) {
+            if (detail::IsReferenceSlot(slot)) {
+                return rescpp::fail(FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+            }
+            Call<Reused>(args, object);
+            slot = Variant::Void();
+            return {};
+        }
+        else {
+            using ValueT = std::remove_cvref_t<typename Traits::ReturnType>;
+
+            if constexpr (std::is_assignable_v<ValueT&, typename Traits::ReturnType>) {
+                if (slot.CanGet<ValueT&>()) {
+                    if (!slot.IsShared()) {
+                        slot.GetUnchecked<ValueT&>() = Call<Reused>(args, object);
+                        return {};
+                    }
+                    // copies of the slot share its value and keep the old one, so the slot gets a value of its own
+                    if constexpr (std::is_constructible_v<ValueT, typename Traits::ReturnType>) {
+                        slot = TRY(Variant::Create<ValueT>(ValueT(Call<Reused>(args, object))));
+                        return {};
+                    }
+                }
+            }
+
+            if (detail::IsReferenceSlot(slot)) {
+                return rescpp::fail(FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+            }
+            // a returned reference is copied, a slot referring to the object would have the next call assign through it
+            if constexpr (std::is_reference_v<typename Traits::ReturnType>
+                && std::is_constructible_v<ValueT, typename Traits::ReturnType>) {
+                slot = TRY(Variant::Create<ValueT>(ValueT(Call<Reused>(args, object))));
+            }
+            else {
+                slot = TRY(Variant::Create<typename Traits::ReturnType>(Call<Reused>(args, object)));
+            }
+            return {};
+        }
+    }
+
+    /// Invokes on the object at 'index' of a batch, see 'InvokeBatchUnchecked'.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> CallAt(ExtractedArgs& args, void* object, const size_t index,
+                                                           const std::span<Variant> results,
+                                                           const std::span<std::optional<FunctionWrapperInvokeError>> errors) const {
+        if (results.empty()) {
+            Call<true>(args, object);
+        }
+        else if (auto result = CallInto<true>(args, object, results[index]); result.has_error()) {
+            if (errors.empty()) {
+                return rescpp::fail<FunctionWrapperBatchError>(result.error(), index);
+            }
+            errors[index] = result.error();
+            return {};
+        }
+
+        if (!errors.empty()) {
+            errors[index].reset();
+        }
+        return {};
+    }
+
 #undef REFLCPP_FUNCTION_WRAPPER_GET_ARGS
-#undef REFLCPP_FUNCTION_WRAPPER_CHECK_ARGS
 
 public:
     FunctionWrapper(T ptr)
@@ -209,19 +429,45 @@ public:
         return Traits::GetArgs();
     }
 
+    /// Delegate of 'Traits::Signature' calling the wrapped function.
+    [[nodiscard]]
+    detail::ErasedDelegate GetDelegate() const noexcept {
+        return detail::MakeErasedDelegate<typename Traits::Signature>(&ptr_);
+    }
+
 public:
     [[nodiscard]]
-    bool CanInvokeWithArgs(const ArgumentList& args) const {
-        return !CheckArgs(args).has_error();
+    bool CanInvokeWithArgs(const ArgumentSpan args) const {
+        return args.size() == Traits::ArgCount && !CheckArgs(args).has_error();
+    }
+
+    /// Same as 'CanInvokeWithArgs', but for any arguments of 'signature'.
+    [[nodiscard]]
+    bool CanInvokeWith(const ArgumentSignature& signature) const noexcept {
+        return signature.Size() == Traits::ArgCount
+            && CanInvokeWithImpl(signature, std::make_index_sequence<Traits::ArgCount>());
     }
 
     [[nodiscard]]
-    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const ArgumentList& args, const Variant& obj) const {
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const ArgumentSpan args, const Variant& obj) const {
         if (args.size() != Traits::ArgCount) {
             //TODO: better way for error handling
             return rescpp::fail(FunctionWrapperInvokeError::Type::IncorrectNumberOfArguments);
         }
 
+        TRY(CheckArgs(args));
+        return InvokeUnchecked(args, obj);
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const std::initializer_list<Variant> args, const Variant& obj) const {
+        return Invoke(ArgumentSpan(args.begin(), args.size()), obj);
+    }
+
+    /// Same as 'Invoke', but expects 'CanInvokeWithArgs(args)' to be true,
+    /// so the arguments are not checked again. The object still is.
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeUnchecked(const ArgumentSpan args, const Variant& obj) const {
         if constexpr (Traits::IsStatic) {
             if constexpr (Traits::HasReturn) {
                 return TRY(InvokeImpl(args, std::make_index_sequence<Traits::ArgCount>()));
@@ -245,5 +491,89 @@ public:
             }
         }
     }
+
+    /// Same as 'InvokeUnchecked', but writes the result into 'slot' instead of returning a new variant.
+    /// A slot which can be gotten as the return type is assigned to, so its storage gets reused,
+    /// unless copies of the slot share its value.
+    /// Slots referring to storage of the caller are never replaced, so they have to match,
+    /// any other slot is replaced by a new variant holding the value, so a returned reference is copied
+    /// unless its type can not be copied.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeUncheckedInto(const ArgumentSpan args, const Variant& obj, Variant& slot) const {
+        TRY(CheckObject(obj));
+        auto extracted = ExtractArgs(args);
+        return CallInto(extracted, ObjectAddress(obj), slot);
+    }
+
+    [[nodiscard]]
+    static bool CanInvokeOn(const Variant& obj) noexcept {
+        return !CheckObject(obj).has_error();
+    }
+
+    /// Invokes on 'count' objects laid out 'stride' bytes apart, starting at the one 'first' holds.
+    /// Only 'first' is checked, so all of them have to be of its type.
+    /// Results are written into 'results' like 'InvokeUncheckedInto' does, unless it is empty.
+    /// Without 'errors' this stops at the first error, otherwise the error of each object is put
+    /// at its index, or cleared if there was none, and the remaining objects are still invoked on.
+    /// Each call gets its own copy of the arguments of rvalue reference parameters,
+    /// so those have to be copyable.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> InvokeBatchUnchecked(const ArgumentSpan args, const Variant& first,
+                                                                         const size_t stride, const size_t count,
+                                                                         const std::span<Variant> results,
+                                                                         const std::span<std::optional<FunctionWrapperInvokeError>> errors) const {
+        if constexpr (!ArgsReusable) {
+            return rescpp::fail<FunctionWrapperBatchError>(FunctionWrapperInvokeError::Type::ArgumentNotCopyable);
+        }
+        else {
+            if (count == 0) {
+                return {};
+            }
+            RESCPP_TRY_IMPL(CheckObject(first), {
+                            return rescpp::fail<FunctionWrapperBatchError>(result_.error(), 0);
+                            });
+
+            auto extracted = ExtractArgs(args);
+            auto* base = static_cast<std::byte*>(ObjectAddress(first));
+            for (size_t i = 0; i < count; ++i) {
+                void* object = Traits::IsStatic ? nullptr : base + i * stride;
+                TRY(CallAt(extracted, object, i, results, errors));
+            }
+            return {};
+        }
+    }
+
+    /// Same as 'InvokeBatchUnchecked', but for objects held by variants of any layout.
+    /// Without 'errors' all objects are checked before the first one is invoked on,
+    /// otherwise objects of the wrong type are skipped.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> InvokeBatchUnchecked(const ArgumentSpan args, const std::span<const Variant> objects,
+                                                                         const std::span<Variant> results,
+                                                                         const std::span<std::optional<FunctionWrapperInvokeError>> errors) const {
+        if constexpr (!ArgsReusable) {
+            return rescpp::fail<FunctionWrapperBatchError>(FunctionWrapperInvokeError::Type::ArgumentNotCopyable);
+        }
+        else {
+            if (errors.empty()) {
+                for (size_t i = 0; i < objects.size(); ++i) {
+                    RESCPP_TRY_IMPL(CheckObject(objects[i]), {
+                                    return rescpp::fail<FunctionWrapperBatchError>(result_.error(), i);
+                                    });
+                }
+            }
+
+            auto extracted = ExtractArgs(args);
+            for (size_t i = 0; i < objects.size(); ++i) {
+                if (!errors.empty()) {
+                    if (auto checked = CheckObject(objects[i]); checked.has_error()) {
+                        errors[i] = checked.error();
+                        continue;
+                    }
+                }
+                TRY(CallAt(extracted, ObjectAddress(objects[i]), i, results, errors));
+            }
+            return {};
+        }
+    }
 };
 }
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "refl-cpp/reflect.hpp"
+#include "refl-cpp/variant.hpp"
+#include "refl-cpp/type_plan_cache.hpp"
+#include "refl-cpp/common/hash_bytes.hpp"
+#include "refl-cpp/common/unreachable.hpp"
+
+namespace ReflCpp {
+enum class HashError : uint8_t {
+    /// A field type is neither trivially copyable, a string, nor made of reflected fields,
+    /// or the offset of a base is not known.
+    Unsupported,
+    IsVoid,
+
+    TypeNotFound,
+
+    ReflectMaxLimitReached,
+    ReflectCreationFailed,
+    ReflectIDCollision,
+
+    OutOfMemory,
+};
+}
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::ReflectError, ReflCpp::HashError> {
+    static ReflCpp::HashError convert(const ReflCpp::ReflectError& error) noexcept {
+        switch (error) {
+            case ReflCpp::ReflectError::MaxLimitReached:
+                return ReflCpp::HashError::ReflectMaxLimitReached;
+            case ReflCpp::ReflectError::CreationFailed:
+                return ReflCpp::HashError::ReflectCreationFailed;
+            case ReflCpp::ReflectError::OutOfMemory:
+                return ReflCpp::HashError::OutOfMemory;
+            case ReflCpp::ReflectError::IDCollision:
+                return ReflCpp::HashError::ReflectIDCollision;
+        }
+        ReflCpp::unreachable<true>();
+    }
+};
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::GetTypeError, ReflCpp::HashError> {
+    static ReflCpp::HashError convert(const ReflCpp::GetTypeError&) noexcept {
+        return ReflCpp::HashError::TypeNotFound;
+    }
+};
+
+namespace ReflCpp {
+/// How objects of a type are hashed, built once per type.
+struct HashPlan {
+    enum class Kind : uint8_t {
+        /// 'size' bytes hashed as one block.
+        Bytes,
+        /// 'float' or 'double', told apart by 'size'.
+        Float,
+        /// The characters of a 'std::string'.
+        String,
+        /// The hashes of every base and then every non-static field mixed in order.
+        Fields,
+    };
+
+    struct Entry {
+        /// Null for a base, which always has a known offset.
+        const Field* field;
+        const HashPlan* plan;
+        /// Offset within the object, or 'UnknownOffset' to ask the field for its address.
+        size_t offset;
+    };
+
+    static constexpr size_t UnknownOffset = SIZE_MAX;
+
+    TypeID type = TypeID::Invalid();
+    Kind kind = Kind::Bytes;
+    size_t size = 0;
+    std::vector<Entry> fields;
+
+    template <typename Cache>
+    [[nodiscard]]
+    static rescpp::result<void, HashError> Build(Cache& cache, const Type& type, HashPlan& plan) noexcept {
+        const TypeLayout& layout = type.GetLayout();
+        if (layout.size == 0) {
+            return rescpp::fail(HashError::Unsupported);
+        }
+
+        plan.type = type.GetID();
+        plan.size = layout.size;
+
+        if (type.Is<std::string>()) {
+            plan.kind = Kind::String;
+            return {};
+        }
+        if (type.Is<float>() || type.Is<double>()) {
+            plan.kind = Kind::Float;
+            return {};
+        }
+        if (type.GetFields().empty() && !type.HasBases()) {
+            if (!layout.triviallyCopyable) {
+                return rescpp::fail(HashError::Unsupported);
+            }
+            plan.kind = Kind::Bytes;
+            return {};
+        }
+
+        plan.kind = Kind::Fields;
+
+        // without padding between or after the fields every byte is part of the value
+        bool packed = layout.triviallyCopyable;
+        size_t covered = 0;
+        for (size_t i = 0; i < type.GetBases().size(); ++i) {
+            const Type& base_type = TRY(type.GetBase(i));
+            if (base_type.GetLayout().empty) {
+                continue;
+            }
+
+            const std::optional<size_t> offset = type.GetBaseOffset(i);
+            if (!offset.has_value()) {
+                return rescpp::fail(HashError::Unsupported);
+            }
+
+            const HashPlan& base_plan = TRY(cache.GetLocked(base_type));
+            try {
+                plan.fields.push_back({ nullptr, &base_plan, *offset });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(HashError::OutOfMemory);
+            }
+
+            packed = packed && base_plan.kind == Kind::Bytes;
+            covered += base_plan.size;
+        }
+
+        for (const Field& field : type.GetFields()) {
+            if (field.IsStatic()) {
+                continue;
+            }
+
+            const Type& field_type = TRY(detail::Reflect(TRY(field.GetType())));
+            const HashPlan& field_plan = TRY(cache.GetLocked(field_type));
+            try {
+                plan.fields.push_back({ &field, &field_plan, field.GetOffset().value_or(UnknownOffset) });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(HashError::OutOfMemory);
+            }
+
+            packed = packed && field_plan.kind == Kind::Bytes;
+            covered += field_plan.size;
+        }
+
+        if (packed && covered == layout.size) {
+            plan.kind = Kind::Bytes;
+            plan.fields.clear();
+        }
+        return {};
+    }
+};
+
+namespace detail {
+using HashPlanCache = TypePlanCache<HashPlan, HashError>;
+
+[[nodiscard]]
+inline uint64_t HashObject(const HashPlan& plan, const void* object) noexcept {
+    switch (plan.kind) {
+        case HashPlan::Kind::Bytes:
+            return HashBytes(object, plan.size);
+        case HashPlan::Kind::Float:
+            // -0.0 equals 0.0, so it hashes like it
+            if (plan.size == sizeof(float)) {
+                const float value = *static_cast<const float*>(object);
+                const float canonical = value == 0.0f ? 0.0f : value;
+                return HashBytes(&canonical, sizeof(canonical));
+            }
+            else {
+                const double value = *static_cast<const double*>(object);
+                const double canonical = value == 0.0 ? 0.0 : value;
+                return HashBytes(&canonical, sizeof(canonical));
+            }
+        case HashPlan::Kind::String: {
+            const auto& string = *static_cast<const std::string*>(object);
+            return HashBytes(string.data(), string.size());
+        }
+        case HashPlan::Kind::Fields: {
+            uint64_t hash = HashPrime5 + plan.fields.size();
+            for (const auto& entry : plan.fields) {
+                const void* field = entry.offset != HashPlan::UnknownOffset
+                                        ? static_cast<const std::byte*>(object) + entry.offset
+                                        : entry.field->AddressIn(object);
+                hash = MixHash(hash, HashObject(*entry.plan, field));
+            }
+            return HashAvalanche(hash);
+        }
+    }
+    ReflCpp::unreachable<true>();
+}
+}
+
+/// Hashes the value of 'object' by mixing the hashes of its bases and non-static fields in order,
+/// so objects 'Equals' finds equal hash the same.
+/// Trivially copyable types whose reflected fields cover every byte and hold no floating point values
+/// are hashed as one block. -0.0 hashes like 0.0, NaN by its bits, which is fine since it equals nothing.
+[[nodiscard]]
+inline rescpp::result<uint64_t, HashError> Hash(const Type& type, const void* object) noexcept {
+    const HashPlan& plan = TRY(detail::HashPlanCache::Instance().Get(type));
+    return detail::HashObject(plan, object);
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<uint64_t, HashError> Hash(const T& object) noexcept {
+    const HashPlan& plan = TRY(detail::HashPlanCache::Instance().Get<T>());
+    return detail::HashObject(plan, &object);
+}
+
+/// Hashes the object a variant holds or refers to, the same as 'Hash' of the object itself.
+/// Pointers are hashed by their address.
+[[nodiscard]]
+inline rescpp::result<uint64_t, HashError> Hash(const Variant& value) noexcept {
+    if (value.IsVoid()) {
+        return rescpp::fail(HashError::IsVoid);
+    }
+
+    const detail::VariantWrapperType wrapper = value.GetWrapperType();
+    if (wrapper == detail::VariantWrapperType::POINTER || wrapper == detail::VariantWrapperType::CONST_POINTER) {
+        const void* address = value.GetAddress();
+        return detail::HashBytes(&address, sizeof(address));
+    }
+
+    // references and qualifiers hash like the type they wrap
+    const auto wraps = [](const TypeFlags& flags) {
+        return !flags.Has(TypeFlags::IsPointer)
+            && (flags.Has(TypeFlags::IsLValueReference) || flags.Has(TypeFlags::IsRValueReference)
+                || flags.Has(TypeFlags::IsConst) || flags.Has(TypeFlags::IsVolatile));
+    };
+
+    const Type* type = &TRY(detail::Reflect(value.GetType()));
+    while (wraps(type->GetFlags())) {
+        type = &TRY(type->GetInner(0));
+    }
+    return Hash(*type, value.GetAddress());
+}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "refl-cpp/argument_signature.hpp"
+
+#include "refl-cpp/impl/variant_wrapper.hpp"
+#include "refl-cpp/reflect.hpp"
+
+namespace ReflCpp {
+namespace detail {
+template <typename First, typename... Rest>
+rescpp::result<void, ReflectError> AddArgumentKeys(std::vector<ArgumentKey>& keys) {
+    keys.push_back({ TRY(ReflectID<First>()), VariantWrapperTypeOf<First>() });
+
+    if constexpr (sizeof...(Rest) == 0) {
+        return {};
+    }
+    else {
+        return AddArgumentKeys<Rest...>(keys);
+    }
+}
+}
+
+template <typename... Args>
+rescpp::result<ArgumentSignature, ReflectError> ArgumentSignature::Of() {
+    std::vector<ArgumentKey> keys;
+    if constexpr (sizeof...(Args) > 0) {
+        keys.reserve(sizeof...(Args));
+        TRY(detail::AddArgumentKeys<Args...>(keys));
+    }
+    return ArgumentSignature(std::move(keys));
+}
+}
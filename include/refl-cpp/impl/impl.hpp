@@ -1,4 +1,5 @@
 #pragma once
 
 #include "refl-cpp/impl/variant.hpp"
+#include "refl-cpp/impl/argument_signature.hpp"
 #include "refl-cpp/impl/method_func_data.hpp"
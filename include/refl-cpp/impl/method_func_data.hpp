@@ -1,11 +1,12 @@
 #pragma once
 
+#include "refl-cpp/common/arena.hpp"
 #include "refl-cpp/method_func_data.hpp"
 #include "refl-cpp/method_func.hpp"
 
 namespace ReflCpp {
 template <typename T>
-MethodFuncData<T>::operator std::shared_ptr<MethodFunc>() const {
-    return std::make_shared<MethodFuncWrapper<T>>(*this);
+MethodFuncData<T>::operator const MethodFunc*() const {
+    return detail::MetadataArena().Create<MethodFuncWrapper<T>>(*this);
 }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "refl-cpp/variant.hpp"
 
 #include "refl-cpp/impl/variant_wrapper.hpp"
@@ -8,9 +10,8 @@
 
 namespace ReflCpp {
 inline Variant& Variant::Void() noexcept {
-    static detail::VoidVariantWrapper wrapper;
     static Variant instance(
-        std::shared_ptr<detail::VoidVariantWrapper>(&wrapper, [](detail::VoidVariantWrapper*) {}),
+        detail::VariantStorage::CreateVoid(),
         ReflectionDatabase::Void().GetID()
     );
     return instance;
@@ -41,33 +42,71 @@ rescpp::result<Variant, ReflectError> Variant::Create(T data) {
 }
 
 template <typename T>
-bool Variant::CanGet() const noexcept {
-#define REFLCPP_VARIANT_MATCH(TYPE) \
-    case detail::VariantWrapperType::TYPE: { \
-        if (detail::VariantMatcher<detail::VariantWrapperType::TYPE, T>::Match(type_)) { \
-            return true; \
-        } \
-        break; \
+    requires (!std::is_reference_v<T> && !std::is_pointer_v<T>)
+rescpp::result<Variant, ReflectError> Variant::CreateTemporary(const T& data) {
+    constexpr auto wrapper = std::is_const_v<T> ? detail::VariantWrapperType::CONST_RVALUE_REF : detail::VariantWrapperType::RVALUE_REF;
+    return Variant(detail::VariantStorage::CreateValue<std::remove_const_t<T>>(wrapper, data), TRY(ReflectID<T&&>()));
+}
+
+namespace detail {
+template <VariantWrapperType Type, typename R>
+concept HasVariantMatcher = requires(void* data) {
+    { VariantMatcher<Type, R>::Get(data) };
+};
+
+/// Compile-time tables indexed by 'VariantWrapperType',
+/// so matching and getting 'T' out of a 'Variant' is a single indexed call.
+template <typename T>
+struct VariantMatchTable {
+    using MatchFunc = bool(*)(TypeID);
+
+private:
+    template <size_t... Indices>
+    static constexpr std::array<MatchFunc, VariantWrapperTypeCount> Make(std::index_sequence<Indices...>) noexcept {
+        return { &VariantMatcher<static_cast<VariantWrapperType>(Indices), T>::Match... };
     }
 
-    switch (base_->GetType()) {
-        REFLCPP_VARIANT_MATCH(VOID)
-        REFLCPP_VARIANT_MATCH(VALUE)
-        REFLCPP_VARIANT_MATCH(CONST_VALUE)
-        REFLCPP_VARIANT_MATCH(LVALUE_REF)
-        REFLCPP_VARIANT_MATCH(CONST_LVALUE_REF)
-        REFLCPP_VARIANT_MATCH(RVALUE_REF)
-        REFLCPP_VARIANT_MATCH(CONST_RVALUE_REF)
-        REFLCPP_VARIANT_MATCH(POINTER)
-        REFLCPP_VARIANT_MATCH(CONST_POINTER)
-
-        default:
-            break;
+public:
+    static constexpr std::array<MatchFunc, VariantWrapperTypeCount> Match =
+        Make(std::make_index_sequence<VariantWrapperTypeCount>());
+};
+
+template <typename ReturnT, typename T>
+struct VariantGetTable {
+    using GetFunc = ReturnT(*)(void*);
+
+private:
+    template <VariantWrapperType Type>
+    static ReturnT GetImpl(void* data) noexcept {
+        if constexpr (HasVariantMatcher<Type, T>) {
+            return VariantMatcher<Type, T>::Get(data);
+        }
+        else {
+            // 'Variant::CanGet' never matches these
+            unreachable<true>();
+        }
     }
 
-#undef REFLCPP_VARIANT_MATCH
+    template <size_t... Indices>
+    static constexpr std::array<GetFunc, VariantWrapperTypeCount> Make(std::index_sequence<Indices...>) noexcept {
+        return { &GetImpl<static_cast<VariantWrapperType>(Indices)>... };
+    }
 
-    return false;
+public:
+    static constexpr std::array<GetFunc, VariantWrapperTypeCount> Get =
+        Make(std::make_index_sequence<VariantWrapperTypeCount>());
+};
+}
+
+template <typename T>
+bool Variant::CanGet(const TypeID type, const detail::VariantWrapperType wrapper) noexcept {
+    const auto index = static_cast<size_t>(wrapper);
+    return detail::VariantMatchTable<T>::Match[index](type);
+}
+
+template <typename T>
+bool Variant::CanGet() const noexcept {
+    return CanGet<T>(type_, storage_.GetType());
 }
 
 template <typename T>
@@ -78,37 +117,19 @@ rescpp::result<void, VariantGetError> Variant::CheckGet() const noexcept {
     return rescpp::fail(VariantGetError::CanNotGet);
 }
 
-namespace detail {
-template <VariantWrapperType Type, typename R>
-concept HasVariantMatcher = requires(VariantBase* base) {
-    { VariantMatcher<Type, R>::Get(base) };
-};
+template <typename T>
+detail::VariantGetResult<T> Variant::GetUnchecked() const noexcept {
+    const auto index = static_cast<size_t>(storage_.GetType());
+    return detail::VariantGetTable<detail::VariantGetResult<T>, T>::Get[index](storage_.GetData());
 }
 
 template <typename ReturnT, typename T>
 rescpp::result<ReturnT, VariantGetError> Variant::GetImpl() const {
+    static_assert(std::is_same_v<ReturnT, detail::VariantGetResult<T>>);
     TRY(CheckVoid());
     TRY(CheckGet<T>());
 
-#define REFLCPP_MATCH_VARIANT(Type) \
-    if constexpr (detail::HasVariantMatcher<detail::VariantWrapperType::Type, T>) { \
-        if (wrapperType == detail::VariantWrapperType::Type) { \
-            return detail::VariantMatcher<detail::VariantWrapperType::Type, T>::Get(base_.get()); \
-        } \
-    }
-
-    const auto wrapperType = base_->GetType();
-    REFLCPP_MATCH_VARIANT(VALUE)
-    REFLCPP_MATCH_VARIANT(CONST_VALUE)
-    REFLCPP_MATCH_VARIANT(LVALUE_REF)
-    REFLCPP_MATCH_VARIANT(CONST_LVALUE_REF)
-    REFLCPP_MATCH_VARIANT(RVALUE_REF)
-    REFLCPP_MATCH_VARIANT(CONST_RVALUE_REF)
-    REFLCPP_MATCH_VARIANT(POINTER)
-    REFLCPP_MATCH_VARIANT(CONST_POINTER)
-
-#undef REFLCPP_MATCH_VARIANT
-    unreachable<true>();
+    return GetUnchecked<T>();
 }
 
 template <typename T>
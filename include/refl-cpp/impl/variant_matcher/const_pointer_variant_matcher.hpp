@@ -5,10 +5,10 @@
 template <typename R>
 struct ReflCpp::detail::VariantMatcher<ReflCpp::detail::VariantWrapperType::CONST_POINTER, const R*> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<const R*>();
+        return type.EqualsCached<const R*>();
     }
 
-    static const R* Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<R*>*>(base)->GetValue();
+    static const R* Get(void* data) noexcept {
+        return static_cast<const R*>(data);
     }
 };
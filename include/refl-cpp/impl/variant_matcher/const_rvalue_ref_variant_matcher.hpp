@@ -2,13 +2,36 @@
 
 #include "refl-cpp/variant.hpp"
 
+template <typename R>
+    requires (!std::is_pointer_v<R> && !std::is_reference_v<R>)
+struct ReflCpp::detail::VariantMatcher<ReflCpp::detail::VariantWrapperType::CONST_RVALUE_REF, const R> {
+    static bool Match(const TypeID type) noexcept {
+        return type.EqualsCached<const R&&>();
+    }
+
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
+    }
+};
+
+template <typename R>
+struct ReflCpp::detail::VariantMatcher<ReflCpp::detail::VariantWrapperType::CONST_RVALUE_REF, const R&> {
+    static bool Match(const TypeID type) noexcept {
+        return type.EqualsCached<const R&&>();
+    }
+
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
+    }
+};
+
 template <typename R>
 struct ReflCpp::detail::VariantMatcher<ReflCpp::detail::VariantWrapperType::CONST_RVALUE_REF, const R&&> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<const R&&>();
+        return type.EqualsCached<const R&&>();
     }
 
-    static const R&& Get(VariantBase* base) noexcept {
-        return std::forward<const R>(static_cast<VariantWrapper<const R&&>*>(base)->GetValue());
+    static const R&& Get(void* data) noexcept {
+        return std::move(*static_cast<const R*>(data));
     }
 };
@@ -7,22 +7,22 @@ template <typename R>
     requires (!std::is_pointer_v<R> && !std::is_reference_v<R>)
 struct VariantMatcher<VariantWrapperType::CONST_VALUE, const R> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<const R>();
+        return type.EqualsCached<const R>();
     }
 
-    static const R& Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<const R&>*>(base)->GetValue();
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
     }
 };
 
 template <typename R>
 struct VariantMatcher<VariantWrapperType::CONST_VALUE, const R&> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<const R>();
+        return type.EqualsCached<const R>();
     }
 
-    static const R& Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<const R&>*>(base)->GetValue();
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
     }
 };
 }
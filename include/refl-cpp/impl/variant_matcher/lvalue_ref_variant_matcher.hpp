@@ -7,11 +7,11 @@ template <typename R>
     requires (!std::is_pointer_v<R> && !std::is_reference_v<R>)
 struct VariantMatcher<VariantWrapperType::LVALUE_REF, R> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R&>();
+        return type.EqualsCached<R&>();
     }
 
-    static R& Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<R&>*>(base)->GetValue();
+    static R& Get(void* data) noexcept {
+        return *static_cast<R*>(data);
     }
 };
 
@@ -19,33 +19,33 @@ template <typename R>
     requires (!std::is_pointer_v<R> && !std::is_reference_v<R>)
 struct VariantMatcher<VariantWrapperType::LVALUE_REF, const R> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R&>();
+        return type.EqualsCached<R&>();
     }
 
-    static const R& Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<R&>*>(base)->GetValue();
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
     }
 };
 
 template <typename R>
 struct VariantMatcher<VariantWrapperType::LVALUE_REF, R&> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R&>();
+        return type.EqualsCached<R&>();
     }
 
-    static R& Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<R&>*>(base)->GetValue();
+    static R& Get(void* data) noexcept {
+        return *static_cast<R*>(data);
     }
 };
 
 template <typename R>
 struct VariantMatcher<VariantWrapperType::LVALUE_REF, const R&> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R&>();
+        return type.EqualsCached<R&>();
     }
 
-    static const R& Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<R&>*>(base)->GetValue();
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
     }
 };
 }
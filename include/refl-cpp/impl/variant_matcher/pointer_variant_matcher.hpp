@@ -6,22 +6,22 @@ namespace ReflCpp::detail {
 template <typename R>
 struct VariantMatcher<VariantWrapperType::POINTER, R*> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R*>();
+        return type.EqualsCached<R*>();
     }
 
-    static R* Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<R*>*>(base)->GetValue();
+    static R* Get(void* data) noexcept {
+        return static_cast<R*>(data);
     }
 };
 
 template <typename R>
 struct VariantMatcher<VariantWrapperType::POINTER, const R*> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R*>();
+        return type.EqualsCached<R*>();
     }
 
-    static const R* Get(VariantBase* base) noexcept {
-        return static_cast<VariantWrapper<R*>*>(base)->GetValue();
+    static const R* Get(void* data) noexcept {
+        return static_cast<const R*>(data);
     }
 };
 }
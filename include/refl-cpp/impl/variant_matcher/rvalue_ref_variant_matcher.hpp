@@ -3,25 +3,62 @@
 #include "refl-cpp/variant.hpp"
 
 namespace ReflCpp::detail {
+// like a temporary, which a by-value parameter copies and a const reference binds to,
+// but a mutable lvalue reference does not
+template <typename R>
+    requires (!std::is_pointer_v<R> && !std::is_reference_v<R>)
+struct VariantMatcher<VariantWrapperType::RVALUE_REF, R> {
+    static bool Match(const TypeID type) noexcept {
+        return type.EqualsCached<R&&>();
+    }
+
+    static R& Get(void* data) noexcept {
+        return *static_cast<R*>(data);
+    }
+};
+
+template <typename R>
+    requires (!std::is_pointer_v<R> && !std::is_reference_v<R>)
+struct VariantMatcher<VariantWrapperType::RVALUE_REF, const R> {
+    static bool Match(const TypeID type) noexcept {
+        return type.EqualsCached<R&&>();
+    }
+
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
+    }
+};
+
+template <typename R>
+struct VariantMatcher<VariantWrapperType::RVALUE_REF, const R&> {
+    static bool Match(const TypeID type) noexcept {
+        return type.EqualsCached<R&&>();
+    }
+
+    static const R& Get(void* data) noexcept {
+        return *static_cast<const R*>(data);
+    }
+};
+
 template <typename R>
 struct VariantMatcher<VariantWrapperType::RVALUE_REF, R&&> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R&&>();
+        return type.EqualsCached<R&&>();
     }
 
-    static R&& Get(VariantBase* base) noexcept {
-        return std::forward<R>(static_cast<VariantWrapper<R&&>*>(base)->GetValue());
+    static R&& Get(void* data) noexcept {
+        return std::move(*static_cast<R*>(data));
     }
 };
 
 template <typename R>
 struct VariantMatcher<VariantWrapperType::RVALUE_REF, const R&&> {
     static bool Match(const TypeID type) noexcept {
-        return type.Equals<R&&>();
+        return type.EqualsCached<R&&>();
     }
 
-    static const R&& Get(VariantBase* base) noexcept {
-        return std::forward<R>(static_cast<VariantWrapper<R&&>*>(base)->GetValue());
+    static const R&& Get(void* data) noexcept {
+        return std::move(*static_cast<const R*>(data));
     }
 };
 }
@@ -4,237 +4,96 @@
 #include "refl-cpp/common/unreachable.hpp"
 
 namespace ReflCpp::detail {
-struct VoidVariantWrapper final : public VariantWrapper<void> {
-    void GetValue() override {}
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const override {
-        return VariantWrapperType::VOID;
-    }
-};
-
-template <typename T>
-struct ValueVariantWrapper final : public VariantWrapper<T&> {
-private:
-    T value_;
-
-public:
-    ValueVariantWrapper(T& value) noexcept
-        : value_(value) {}
-
-    [[nodiscard]]
-    T& GetValue() override {
-        return value_;
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const override {
-        return VariantWrapperType::VALUE;
-    }
-};
-
-template <typename T>
-struct ConstValueVariantWrapper final : public VariantWrapper<const T&> {
-private:
-    const T value_;
-
-public:
-    ConstValueVariantWrapper(const T& value) noexcept
-        : value_(value) {}
-
-    [[nodiscard]]
-    const T& GetValue() noexcept override {
-        return value_;
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const noexcept override {
-        return VariantWrapperType::CONST_VALUE;
-    }
-};
-
-template <typename T>
-struct LValueRefVariantWrapper final : public VariantWrapper<T&> {
-private:
-    T& value_;
-
-public:
-    LValueRefVariantWrapper(T& value) noexcept
-        : value_(value) {}
-
-    [[nodiscard]]
-    T& GetValue() noexcept override {
-        return value_;
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const noexcept override {
-        return VariantWrapperType::LVALUE_REF;
-    }
-};
-
-template <typename T>
-struct ConstLValueRefVariantWrapper final : public VariantWrapper<const T&> {
-private:
-    const T& value_;
-
-public:
-    ConstLValueRefVariantWrapper(const T& value) noexcept
-        : value_(value) {}
-
-
-    [[nodiscard]]
-    const T& GetValue() noexcept override {
-        return value_;
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const noexcept override {
-        return VariantWrapperType::CONST_LVALUE_REF;
-    }
-};
-
-template <typename T>
-struct RValueRefVariantWrapper final : public VariantWrapper<T&&> {
-private:
-    T&& value_;
-
-public:
-    RValueRefVariantWrapper(T&& value) noexcept
-        : value_(std::move(value)) {}
-
-    [[nodiscard]]
-    T&& GetValue() noexcept override {
-        return std::move(value_);
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const noexcept override {
-        return VariantWrapperType::RVALUE_REF;
-    }
-};
-
-template <typename T>
-struct ConstRValueRefVariantWrapper final : public VariantWrapper<const T&&> {
-private:
-    const T&& value_;
-
-public:
-    ConstRValueRefVariantWrapper(const T&& value) noexcept
-        : value_(std::move(value)) {}
-
-
-    [[nodiscard]]
-    const T&& GetValue() noexcept override {
-        return std::move(value_);
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const noexcept override {
-        return VariantWrapperType::CONST_RVALUE_REF;
-    }
-};
-
-template <typename T>
-struct PointerVariantWrapper final : public VariantWrapper<T*> {
-private:
-    T* value_;
-
-public:
-    PointerVariantWrapper(T* value) noexcept
-        : value_(value) {}
-
-    [[nodiscard]]
-    T* GetValue() noexcept override {
-        return value_;
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const noexcept override {
-        return VariantWrapperType::POINTER;
-    }
-};
-
-template <typename T>
-struct ConstPointerVariantWrapper final : public VariantWrapper<const T*> {
-private:
-    const T* value_;
-
-public:
-    ConstPointerVariantWrapper(const T* value) noexcept
-        : value_(value) {}
-
-    [[nodiscard]]
-    const T* GetValue() noexcept override {
-        return value_;
-    }
-
-    [[nodiscard]]
-    VariantWrapperType GetType() const noexcept override {
-        return VariantWrapperType::CONST_POINTER;
-    }
-};
-
 template <typename T, typename CleanT>
-std::shared_ptr<VariantBase> MakeValueWrapper(T&& data) {
+VariantStorage MakeValueWrapper(T&& data) {
     if constexpr (std::is_copy_constructible_v<T>) {
         if constexpr (std::is_const_v<T>) {
-            return std::make_shared<ConstValueVariantWrapper<CleanT>>(data);
+            return VariantStorage::CreateValue<CleanT>(VariantWrapperType::CONST_VALUE, data);
         }
         else {
-            return std::make_shared<ValueVariantWrapper<CleanT>>(data);
+            return VariantStorage::CreateValue<CleanT>(VariantWrapperType::VALUE, data);
         }
     }
     else if constexpr (std::is_move_constructible_v<T>) {
-        return std::make_shared<ValueVariantWrapper<CleanT>>(std::forward<T>(data));
+        return VariantStorage::CreateValue<CleanT>(VariantWrapperType::VALUE, std::forward<T>(data));
     }
     else {
-        return std::make_shared<ConstLValueRefVariantWrapper<CleanT>>(data);
+        return VariantStorage::CreateAddress(VariantWrapperType::CONST_LVALUE_REF, &data);
     }
 }
 
-template <typename T, bool IsConst_ = false, typename CleanT_>
-std::shared_ptr<VariantBase> MakeLValueRefWrapper(T&& data) {
+template <typename T, bool IsConst_ = false>
+VariantStorage MakeLValueRefWrapper(T&& data) {
     if constexpr (IsConst_) {
-        return std::make_shared<ConstLValueRefVariantWrapper<CleanT_>>(data);
+        return VariantStorage::CreateAddress(VariantWrapperType::CONST_LVALUE_REF, &data);
     }
     else {
-        return std::make_shared<LValueRefVariantWrapper<CleanT_>>(data);
+        return VariantStorage::CreateAddress(VariantWrapperType::LVALUE_REF, &data);
     }
 }
 
-template <typename T, bool IsConst_ = false, typename CleanT_>
-std::shared_ptr<VariantBase> MakeRValueRefWrapper(T&& data) {
+template <typename T, bool IsConst_ = false>
+VariantStorage MakeRValueRefWrapper(T&& data) {
     if constexpr (IsConst_) {
-        return std::make_shared<ConstRValueRefVariantWrapper<CleanT_>>(std::forward<T>(data));
+        return VariantStorage::CreateAddress(VariantWrapperType::CONST_RVALUE_REF, &data);
     }
     else {
-        return std::make_shared<RValueRefVariantWrapper<CleanT_>>(std::forward<T>(data));
+        return VariantStorage::CreateAddress(VariantWrapperType::RVALUE_REF, &data);
     }
 }
 
-template <typename T, bool IsConst_ = false, typename CleanT_>
-std::shared_ptr<VariantBase> MakePointerWrapper(T&& data) {
+template <typename T, bool IsConst_ = false>
+VariantStorage MakePointerWrapper(T&& data) {
     if constexpr (IsConst_) {
-        return std::make_shared<ConstPointerVariantWrapper<CleanT_>>(data);
+        return VariantStorage::CreateAddress(VariantWrapperType::CONST_POINTER, data);
+    }
+    else {
+        return VariantStorage::CreateAddress(VariantWrapperType::POINTER, data);
+    }
+}
+
+/// Wrapper type 'MakeWrapper<T>' picks, without needing a value.
+template <typename T>
+constexpr VariantWrapperType VariantWrapperTypeOf() noexcept {
+    using CleanT = std::remove_const_t<std::remove_pointer_t<std::remove_reference_t<T>>>;
+
+    if constexpr (std::is_lvalue_reference_v<T>) {
+        return std::is_const_v<std::remove_reference_t<T>> ? VariantWrapperType::CONST_LVALUE_REF : VariantWrapperType::LVALUE_REF;
+    }
+    else if constexpr (std::is_rvalue_reference_v<T>) {
+        return std::is_const_v<std::remove_reference_t<T>> ? VariantWrapperType::CONST_RVALUE_REF : VariantWrapperType::RVALUE_REF;
+    }
+    else if constexpr (std::is_pointer_v<T>) {
+        return std::is_const_v<std::remove_pointer_t<T>> ? VariantWrapperType::CONST_POINTER : VariantWrapperType::POINTER;
+    }
+    else if constexpr (std::is_copy_constructible_v<CleanT> || std::is_move_constructible_v<CleanT>) {
+        if constexpr (std::is_copy_constructible_v<T>) {
+            return std::is_const_v<T> ? VariantWrapperType::CONST_VALUE : VariantWrapperType::VALUE;
+        }
+        else if constexpr (std::is_move_constructible_v<T>) {
+            return VariantWrapperType::VALUE;
+        }
+        else {
+            return VariantWrapperType::CONST_LVALUE_REF;
+        }
     }
     else {
-        return std::make_shared<PointerVariantWrapper<CleanT_>>(data);
+        return std::is_const_v<T> ? VariantWrapperType::CONST_LVALUE_REF : VariantWrapperType::LVALUE_REF;
     }
 }
 
 template <typename T>
-std::shared_ptr<VariantBase> MakeWrapper(T&& data) {
+VariantStorage MakeWrapper(T&& data) {
     using CleanT = std::remove_const_t<std::remove_pointer_t<std::remove_reference_t<T>>>;
 
     if constexpr (std::is_lvalue_reference_v<T>) {
-        return MakeLValueRefWrapper<T, std::is_const_v<std::remove_reference_t<T>>, CleanT>(std::forward<T>(data));
+        return MakeLValueRefWrapper<T, std::is_const_v<std::remove_reference_t<T>>>(std::forward<T>(data));
     }
     else if constexpr (std::is_rvalue_reference_v<T>) {
-        return MakeRValueRefWrapper<T, std::is_const_v<std::remove_reference_t<T>>, CleanT>(std::forward<T>(data));
+        return MakeRValueRefWrapper<T, std::is_const_v<std::remove_reference_t<T>>>(std::forward<T>(data));
     }
     else if constexpr (std::is_pointer_v<T>) {
-        return MakePointerWrapper<T, std::is_const_v<std::remove_pointer_t<T>>, CleanT>(std::forward<T>(data));
+        return MakePointerWrapper<T, std::is_const_v<std::remove_pointer_t<T>>>(std::forward<T>(data));
     }
     else {
         if constexpr (std::is_copy_constructible_v<CleanT> || std::is_move_constructible_v<CleanT>) {
@@ -242,7 +101,7 @@ std::shared_ptr<VariantBase> MakeWrapper(T&& data) {
             return MakeValueWrapper<T, CleanT>(std::forward<T>(data));
         }
         else {
-            return MakeLValueRefWrapper<T, std::is_const_v<T>, CleanT>(std::forward<T>(data));
+            return MakeLValueRefWrapper<T, std::is_const_v<T>>(std::forward<T>(data));
         }
     }
 
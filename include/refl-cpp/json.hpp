@@ -0,0 +1,769 @@
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "refl-cpp/reflect.hpp"
+#include "refl-cpp/type_plan_cache.hpp"
+#include "refl-cpp/common/name_index.hpp"
+#include "refl-cpp/common/unreachable.hpp"
+
+namespace ReflCpp {
+enum class JsonError : uint8_t {
+    /// A field type is neither a number, bool, string, nor made of reflected fields,
+    /// a base that is not empty has no reflected fields, or the offset of a base is not known.
+    Unsupported,
+    WriteFailed,
+
+    UnexpectedEnd,
+    UnexpectedCharacter,
+    InvalidNumber,
+    NumberOutOfRange,
+    InvalidString,
+    TooDeep,
+
+    TypeNotFound,
+
+    ReflectMaxLimitReached,
+    ReflectCreationFailed,
+    ReflectIDCollision,
+
+    OutOfMemory,
+};
+}
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::ReflectError, ReflCpp::JsonError> {
+    static ReflCpp::JsonError convert(const ReflCpp::ReflectError& error) noexcept {
+        switch (error) {
+            case ReflCpp::ReflectError::MaxLimitReached:
+                return ReflCpp::JsonError::ReflectMaxLimitReached;
+            case ReflCpp::ReflectError::CreationFailed:
+                return ReflCpp::JsonError::ReflectCreationFailed;
+            case ReflCpp::ReflectError::OutOfMemory:
+                return ReflCpp::JsonError::OutOfMemory;
+            case ReflCpp::ReflectError::IDCollision:
+                return ReflCpp::JsonError::ReflectIDCollision;
+        }
+        ReflCpp::unreachable<true>();
+    }
+};
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::GetTypeError, ReflCpp::JsonError> {
+    static ReflCpp::JsonError convert(const ReflCpp::GetTypeError&) noexcept {
+        return ReflCpp::JsonError::TypeNotFound;
+    }
+};
+
+namespace ReflCpp {
+/// How objects of a type are written to and read from JSON, built once per type.
+struct JsonPlan {
+    enum class Kind : uint8_t {
+        Bool,
+        /// Signed integer or enum of 'size' bytes.
+        Int,
+        /// Unsigned integer or enum of 'size' bytes.
+        UInt,
+        /// 'float' or 'double', told apart by 'size'.
+        Float,
+        String,
+        /// Every non-static field as a member, the ones of the bases first.
+        Object,
+    };
+
+    struct Entry {
+        const Field* field;
+        const JsonPlan* plan;
+
+        /// Offset of the base declaring the field within the object, 0 for own fields.
+        size_t offset;
+
+        /// Quoted and escaped name followed by a colon, written as it is.
+        std::string key;
+    };
+
+    Kind kind = Kind::Object;
+    size_t size = 0;
+    std::vector<Entry> fields;
+
+    /// Member names to their index in 'fields'.
+    detail::NameIndex index;
+
+    template <typename Cache>
+    [[nodiscard]]
+    static rescpp::result<void, JsonError> Build(Cache& cache, const Type& type, JsonPlan& plan) noexcept {
+        const TypeLayout& layout = type.GetLayout();
+        plan.size = layout.size;
+
+        if (type.Is<bool>()) {
+            plan.kind = Kind::Bool;
+        }
+        else if (layout.integer && (layout.size == 1 || layout.size == 2 || layout.size == 4 || layout.size == 8)) {
+            // enums are written as their value, 'char' as a number of the signedness it has here
+            plan.kind = layout.signedInteger ? Kind::Int : Kind::UInt;
+        }
+        else if (type.Is<float>() || type.Is<double>()) {
+            plan.kind = Kind::Float;
+        }
+        else if (type.Is<std::string>()) {
+            plan.kind = Kind::String;
+        }
+        else if (!type.GetFields().empty() || type.HasBases()) {
+            plan.kind = Kind::Object;
+            try {
+                for (size_t i = 0; i < type.GetBases().size(); ++i) {
+                    const Type& base_type = TRY(type.GetBase(i));
+                    if (base_type.GetLayout().empty) {
+                        continue;
+                    }
+
+                    const std::optional<size_t> offset = type.GetBaseOffset(i);
+                    if (!offset.has_value()) {
+                        return rescpp::fail(JsonError::Unsupported);
+                    }
+
+                    // members of the base become members of the object, unless an own field hides them
+                    const JsonPlan& base_plan = TRY(cache.GetLocked(base_type));
+                    if (base_plan.kind != Kind::Object) {
+                        // a base like 'std::string' has no members to add
+                        return rescpp::fail(JsonError::Unsupported);
+                    }
+                    for (const Entry& entry : base_plan.fields) {
+                        if (!type.GetField(entry.field->GetName()).has_value()) {
+                            plan.fields.push_back({ entry.field, entry.plan, *offset + entry.offset, entry.key });
+                        }
+                    }
+                }
+
+                for (const Field& field : type.GetFields()) {
+                    if (field.IsStatic()) {
+                        continue;
+                    }
+
+                    const Type& field_type = TRY(detail::Reflect(TRY(field.GetType())));
+                    const JsonPlan& field_plan = TRY(cache.GetLocked(field_type));
+
+                    std::string key;
+                    AppendEscaped(key, field.GetName());
+                    key += ':';
+                    plan.fields.push_back({ &field, &field_plan, 0, std::move(key) });
+                }
+                plan.index = detail::NameIndex(plan.fields, [](const Entry& entry) {
+                    return entry.field->GetName();
+                });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(JsonError::OutOfMemory);
+            }
+        }
+        else {
+            return rescpp::fail(JsonError::Unsupported);
+        }
+        return {};
+    }
+
+    /// Appends 'text' quoted, escaping what JSON requires.
+    static void AppendEscaped(std::string& out, const std::string_view text) {
+        static constexpr char Hex[] = "0123456789abcdef";
+
+        out += '"';
+        size_t run = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            const auto c = static_cast<unsigned char>(text[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+
+            out.append(text.data() + run, i - run);
+            run = i + 1;
+            switch (c) {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                case '\t':
+                    out += "\\t";
+                    break;
+                default:
+                    out += "\\u00";
+                    out += Hex[c >> 4];
+                    out += Hex[c & 0xF];
+            }
+        }
+        out.append(text.data() + run, text.size() - run);
+        out += '"';
+    }
+};
+
+namespace detail {
+using JsonPlanCache = TypePlanCache<JsonPlan, JsonError>;
+
+/// Buffers output and hands it to the stream in large pieces,
+/// since writing single characters to a 'std::ostream' is slow.
+struct JsonWriter {
+    std::ostream& out;
+    std::string& buffer;
+
+    void Flush() {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+
+    template <typename T>
+    void Number(const T value) {
+        char chars[32];
+        const auto result = std::to_chars(chars, chars + sizeof(chars), value);
+        buffer.append(chars, result.ptr);
+    }
+
+    void Value(const JsonPlan& plan, const void* object) {
+        switch (plan.kind) {
+            case JsonPlan::Kind::Bool:
+                buffer += *static_cast<const bool*>(object) ? "true" : "false";
+                return;
+            case JsonPlan::Kind::Int:
+                switch (plan.size) {
+                    case 1:
+                        return Number(*static_cast<const int8_t*>(object));
+                    case 2:
+                        return Number(*static_cast<const int16_t*>(object));
+                    case 4:
+                        return Number(*static_cast<const int32_t*>(object));
+                    default:
+                        return Number(*static_cast<const int64_t*>(object));
+                }
+            case JsonPlan::Kind::UInt:
+                switch (plan.size) {
+                    case 1:
+                        return Number(*static_cast<const uint8_t*>(object));
+                    case 2:
+                        return Number(*static_cast<const uint16_t*>(object));
+                    case 4:
+                        return Number(*static_cast<const uint32_t*>(object));
+                    default:
+                        return Number(*static_cast<const uint64_t*>(object));
+                }
+            case JsonPlan::Kind::Float: {
+                const double value = plan.size == sizeof(float)
+                                         ? static_cast<double>(*static_cast<const float*>(object))
+                                         : *static_cast<const double*>(object);
+                // JSON has no infinity or NaN
+                if (!std::isfinite(value)) {
+                    buffer += "null";
+                }
+                else if (plan.size == sizeof(float)) {
+                    Number(*static_cast<const float*>(object));
+                }
+                else {
+                    Number(value);
+                }
+                return;
+            }
+            case JsonPlan::Kind::String:
+                JsonPlan::AppendEscaped(buffer, *static_cast<const std::string*>(object));
+                return;
+            case JsonPlan::Kind::Object:
+                buffer += '{';
+                for (size_t i = 0; i < plan.fields.size(); ++i) {
+                    const auto& entry = plan.fields[i];
+                    if (i != 0) {
+                        buffer += ',';
+                    }
+                    buffer += entry.key;
+                    Value(*entry.plan, entry.field->AddressIn(static_cast<const std::byte*>(object) + entry.offset));
+                }
+                buffer += '}';
+                return;
+        }
+    }
+};
+
+struct JsonReader {
+    static constexpr size_t MaxDepth = 256;
+
+    std::string_view input;
+    size_t position = 0;
+
+    // decoded strings with escapes, reused between them
+    std::string scratch;
+
+    void SkipWhitespace() noexcept {
+        while (position < input.size()) {
+            const char c = input[position];
+            if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                return;
+            }
+            ++position;
+        }
+    }
+
+    [[nodiscard]]
+    rescpp::result<char, JsonError> Peek() noexcept {
+        SkipWhitespace();
+        if (position >= input.size()) {
+            return rescpp::fail(JsonError::UnexpectedEnd);
+        }
+        return input[position];
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, JsonError> Expect(const char expected) noexcept {
+        if (TRY(Peek()) != expected) {
+            return rescpp::fail(JsonError::UnexpectedCharacter);
+        }
+        ++position;
+        return {};
+    }
+
+    /// Consumes 'literal' if the input continues with it.
+    [[nodiscard]]
+    bool Consume(const std::string_view literal) noexcept {
+        if (input.substr(position, literal.size()) != literal) {
+            return false;
+        }
+        position += literal.size();
+        return true;
+    }
+
+    [[nodiscard]]
+    rescpp::result<uint32_t, JsonError> ReadHex4() noexcept {
+        if (input.size() - position < 4) {
+            return rescpp::fail(JsonError::UnexpectedEnd);
+        }
+        uint32_t value = 0;
+        const auto result = std::from_chars(input.data() + position, input.data() + position + 4, value, 16);
+        if (result.ptr != input.data() + position + 4) {
+            return rescpp::fail(JsonError::InvalidString);
+        }
+        position += 4;
+        return value;
+    }
+
+    static void AppendUtf8(std::string& out, const uint32_t code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        }
+        else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | code >> 6);
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | code >> 12);
+            out += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else {
+            out += static_cast<char>(0xF0 | code >> 18);
+            out += static_cast<char>(0x80 | (code >> 12 & 0x3F));
+            out += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    /// Control characters have to be escaped within strings.
+    [[nodiscard]]
+    static bool IsControl(const char c) noexcept {
+        return static_cast<unsigned char>(c) < 0x20;
+    }
+
+    /// Points into the input if the string has no escapes and into 'scratch' otherwise,
+    /// so it is only valid until the next string is read.
+    [[nodiscard]]
+    rescpp::result<std::string_view, JsonError> String() noexcept {
+        TRY(Expect('"'));
+
+        const size_t start = position;
+        while (position < input.size() && input[position] != '"' && input[position] != '\\'
+            && !IsControl(input[position])) {
+            ++position;
+        }
+        if (position >= input.size()) {
+            return rescpp::fail(JsonError::UnexpectedEnd);
+        }
+        if (input[position] == '"') {
+            return input.substr(start, position++ - start);
+        }
+        if (IsControl(input[position])) {
+            return rescpp::fail(JsonError::InvalidString);
+        }
+
+        try {
+            scratch.assign(input.data() + start, position - start);
+            while (true) {
+                if (position >= input.size()) {
+                    return rescpp::fail(JsonError::UnexpectedEnd);
+                }
+
+                const char c = input[position++];
+                if (c == '"') {
+                    return std::string_view(scratch);
+                }
+                if (IsControl(c)) {
+                    return rescpp::fail(JsonError::InvalidString);
+                }
+                if (c != '\\') {
+                    scratch += c;
+                    continue;
+                }
+
+                if (position >= input.size()) {
+                    return rescpp::fail(JsonError::UnexpectedEnd);
+                }
+                switch (input[position++]) {
+                    case '"':
+                        scratch += '"';
+                        break;
+                    case '\\':
+                        scratch += '\\';
+                        break;
+                    case '/':
+                        scratch += '/';
+                        break;
+                    case 'b':
+                        scratch += '\b';
+                        break;
+                    case 'f':
+                        scratch += '\f';
+                        break;
+                    case 'n':
+                        scratch += '\n';
+                        break;
+                    case 'r':
+                        scratch += '\r';
+                        break;
+                    case 't':
+                        scratch += '\t';
+                        break;
+                    case 'u': {
+                        uint32_t code = TRY(ReadHex4());
+                        if (code >= 0xD800 && code < 0xDC00) {
+                            // high surrogate, the low one has to follow
+                            if (!Consume("\\u")) {
+                                return rescpp::fail(JsonError::InvalidString);
+                            }
+                            const uint32_t low = TRY(ReadHex4());
+                            if (low < 0xDC00 || low >= 0xE000) {
+                                return rescpp::fail(JsonError::InvalidString);
+                            }
+                            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        }
+                        else if (code >= 0xDC00 && code < 0xE000) {
+                            return rescpp::fail(JsonError::InvalidString);
+                        }
+                        AppendUtf8(scratch, code);
+                        break;
+                    }
+                    default:
+                        return rescpp::fail(JsonError::InvalidString);
+                }
+            }
+        }
+        catch (const std::exception&) {
+            return rescpp::fail(JsonError::OutOfMemory);
+        }
+    }
+
+    /// Skips the digits at 'index', returns where they end.
+    [[nodiscard]]
+    size_t SkipDigits(size_t index) const noexcept {
+        while (index < input.size() && input[index] >= '0' && input[index] <= '9') {
+            ++index;
+        }
+        return index;
+    }
+
+    /// End of the number at 'position', which has to follow the JSON grammar,
+    /// since 'from_chars' also takes 'inf', 'nan' and leading zeros.
+    [[nodiscard]]
+    rescpp::result<size_t, JsonError> NumberEnd() const noexcept {
+        size_t index = position;
+        if (index < input.size() && input[index] == '-') {
+            ++index;
+        }
+
+        if (index < input.size() && input[index] == '0') {
+            ++index;
+        }
+        else if (const size_t digits = SkipDigits(index); digits != index) {
+            index = digits;
+        }
+        else {
+            return rescpp::fail(JsonError::InvalidNumber);
+        }
+
+        if (index < input.size() && input[index] == '.') {
+            const size_t digits = SkipDigits(index + 1);
+            if (digits == index + 1) {
+                return rescpp::fail(JsonError::InvalidNumber);
+            }
+            index = digits;
+        }
+
+        if (index < input.size() && (input[index] == 'e' || input[index] == 'E')) {
+            ++index;
+            if (index < input.size() && (input[index] == '+' || input[index] == '-')) {
+                ++index;
+            }
+            const size_t digits = SkipDigits(index);
+            if (digits == index) {
+                return rescpp::fail(JsonError::InvalidNumber);
+            }
+            index = digits;
+        }
+        return index;
+    }
+
+    /// Parses a number as 'T' and checks nothing of it is left over.
+    template <typename T>
+    [[nodiscard]]
+    rescpp::result<T, JsonError> Number() noexcept {
+        SkipWhitespace();
+        const size_t number_end = TRY(NumberEnd());
+
+        T value{};
+        const char* begin = input.data() + position;
+        const char* end = input.data() + number_end;
+        const auto result = std::from_chars(begin, end, value);
+        if (result.ec == std::errc::result_out_of_range) {
+            return rescpp::fail(JsonError::NumberOutOfRange);
+        }
+        if (result.ec != std::errc() || result.ptr != end) {
+            // a fraction or exponent for an integer
+            return rescpp::fail(JsonError::InvalidNumber);
+        }
+        position = number_end;
+        return value;
+    }
+
+    template <typename Wide, typename T>
+    [[nodiscard]]
+    rescpp::result<void, JsonError> Integer(void* object) noexcept {
+        const Wide value = TRY(Number<Wide>());
+        if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+            return rescpp::fail(JsonError::NumberOutOfRange);
+        }
+        if (object) {
+            *static_cast<T*>(object) = static_cast<T>(value);
+        }
+        return {};
+    }
+
+    /// Skips any value, for members without a field.
+    [[nodiscard]]
+    rescpp::result<void, JsonError> Skip(const size_t depth) noexcept {
+        if (depth > MaxDepth) {
+            return rescpp::fail(JsonError::TooDeep);
+        }
+
+        const char c = TRY(Peek());
+        if (c == '"') {
+            TRY(String());
+            return {};
+        }
+        if (c == '{' || c == '[') {
+            const char close = c == '{' ? '}' : ']';
+            ++position;
+            if (TRY(Peek()) == close) {
+                ++position;
+                return {};
+            }
+            while (true) {
+                if (c == '{') {
+                    TRY(String());
+                    TRY(Expect(':'));
+                }
+                TRY(Skip(depth + 1));
+
+                const char next = TRY(Peek());
+                ++position;
+                if (next == close) {
+                    return {};
+                }
+                if (next != ',') {
+                    return rescpp::fail(JsonError::UnexpectedCharacter);
+                }
+            }
+        }
+        if (Consume("true") || Consume("false") || Consume("null")) {
+            return {};
+        }
+        TRY(Number<double>());
+        return {};
+    }
+
+    /// A null 'object' parses the value without storing it, which is done for const fields.
+    /// 'null' leaves the value as it is.
+    [[nodiscard]]
+    rescpp::result<void, JsonError> Value(const JsonPlan& plan, void* object, const size_t depth) noexcept {
+        if (depth > MaxDepth) {
+            return rescpp::fail(JsonError::TooDeep);
+        }
+        if (TRY(Peek()) == 'n' && Consume("null")) {
+            return {};
+        }
+
+        switch (plan.kind) {
+            case JsonPlan::Kind::Bool: {
+                bool value;
+                if (Consume("true")) {
+                    value = true;
+                }
+                else if (Consume("false")) {
+                    value = false;
+                }
+                else {
+                    return rescpp::fail(JsonError::UnexpectedCharacter);
+                }
+                if (object) {
+                    *static_cast<bool*>(object) = value;
+                }
+                return {};
+            }
+            case JsonPlan::Kind::Int:
+                switch (plan.size) {
+                    case 1:
+                        return Integer<int64_t, int8_t>(object);
+                    case 2:
+                        return Integer<int64_t, int16_t>(object);
+                    case 4:
+                        return Integer<int64_t, int32_t>(object);
+                    default:
+                        return Integer<int64_t, int64_t>(object);
+                }
+            case JsonPlan::Kind::UInt:
+                switch (plan.size) {
+                    case 1:
+                        return Integer<uint64_t, uint8_t>(object);
+                    case 2:
+                        return Integer<uint64_t, uint16_t>(object);
+                    case 4:
+                        return Integer<uint64_t, uint32_t>(object);
+                    default:
+                        return Integer<uint64_t, uint64_t>(object);
+                }
+            case JsonPlan::Kind::Float:
+                if (plan.size == sizeof(float)) {
+                    const float value = TRY(Number<float>());
+                    if (object) {
+                        *static_cast<float*>(object) = value;
+                    }
+                }
+                else {
+                    const double value = TRY(Number<double>());
+                    if (object) {
+                        *static_cast<double*>(object) = value;
+                    }
+                }
+                return {};
+            case JsonPlan::Kind::String: {
+                const std::string_view value = TRY(String());
+                if (object) {
+                    try {
+                        static_cast<std::string*>(object)->assign(value);
+                    }
+                    catch (const std::exception&) {
+                        return rescpp::fail(JsonError::OutOfMemory);
+                    }
+                }
+                return {};
+            }
+            case JsonPlan::Kind::Object: {
+                TRY(Expect('{'));
+                if (TRY(Peek()) == '}') {
+                    ++position;
+                    return {};
+                }
+                while (true) {
+                    const size_t index = plan.index.Find(TRY(String()));
+                    TRY(Expect(':'));
+                    if (index == NameIndex::NotFound) {
+                        TRY(Skip(depth + 1));
+                    }
+                    else {
+                        const auto& entry = plan.fields[index];
+                        void* field = object && !entry.field->IsConst()
+                                          ? entry.field->AddressIn(static_cast<std::byte*>(object) + entry.offset)
+                                          : nullptr;
+                        TRY(Value(*entry.plan, field, depth + 1));
+                    }
+
+                    const char next = TRY(Peek());
+                    ++position;
+                    if (next == '}') {
+                        return {};
+                    }
+                    if (next != ',') {
+                        return rescpp::fail(JsonError::UnexpectedCharacter);
+                    }
+                }
+            }
+        }
+        ReflCpp::unreachable<true>();
+    }
+};
+}
+
+/// Writes 'object' as a JSON object of its non-static fields and the ones of its bases, nested reflected types included.
+[[nodiscard]]
+inline rescpp::result<void, JsonError> WriteJson(const Type& type, const void* object, std::ostream& out) noexcept {
+    const JsonPlan& plan = TRY(detail::JsonPlanCache::Instance().Get(type));
+    try {
+        // kept between calls, so writing small objects does not allocate
+        thread_local std::string buffer;
+        buffer.clear();
+
+        detail::JsonWriter writer{ out, buffer };
+        writer.Value(plan, object);
+        writer.Flush();
+    }
+    catch (const std::exception&) {
+        return rescpp::fail(JsonError::OutOfMemory);
+    }
+    if (!out) {
+        return rescpp::fail(JsonError::WriteFailed);
+    }
+    return {};
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<void, JsonError> WriteJson(const T& object, std::ostream& out) noexcept {
+    return WriteJson(TRY(Reflect<T>()), &object, out);
+}
+
+/// Reads one JSON value from the start of 'in' into 'object' and returns the characters it took,
+/// including the whitespace after it, so values written one after another can be read the same way.
+/// Members without a field are skipped, fields without a member and const fields keep their value.
+[[nodiscard]]
+inline rescpp::result<size_t, JsonError> ReadJson(const Type& type, const std::string_view in, void* object) noexcept {
+    const JsonPlan& plan = TRY(detail::JsonPlanCache::Instance().Get(type));
+
+    detail::JsonReader reader{ in };
+    TRY(reader.Value(plan, object, 0));
+    reader.SkipWhitespace();
+    return reader.position;
+}
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<size_t, JsonError> ReadJson(const std::string_view in, T& object) noexcept {
+    return ReadJson(TRY(Reflect<T>()), in, &object);
+}
+}
@@ -1,20 +1,108 @@
 #pragma once
 
+#include <initializer_list>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <vector>
 
+#include "refl-cpp/common/arena.hpp"
 #include "refl-cpp/method_data.hpp"
 #include "refl-cpp/method_wrapper.hpp"
+#include "refl-cpp/argument_pack.hpp"
+#include "refl-cpp/overload_cache.hpp"
+#include "refl-cpp/prepared_call.hpp"
+#include "refl-cpp/thread_pool.hpp"
 
 namespace ReflCpp {
+namespace detail {
+/// Keeps the error of the lowest index reported from any thread.
+struct FirstBatchError {
+private:
+    std::mutex mutex_;
+    std::optional<FunctionWrapperBatchError> error_;
+
+public:
+    void Report(const FunctionWrapperBatchError& error) {
+        std::lock_guard lock(mutex_);
+        if (!error_.has_value() || error.index < error_->index) {
+            error_ = error;
+        }
+    }
+
+    /// Reports an error of the chunk starting at 'begin', which it is relative to.
+    void Report(FunctionWrapperBatchError error, const size_t begin) {
+        if (error.index != FunctionWrapperBatchError::NoIndex) {
+            error.index += begin;
+        }
+        Report(error);
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> Get() const {
+        if (error_.has_value()) {
+            return rescpp::fail(*error_);
+        }
+        return {};
+    }
+};
+
+template <typename T>
+[[nodiscard]]
+std::span<T> SubspanOrEmpty(const std::span<T> span, const size_t begin, const size_t end) noexcept {
+    return span.empty() ? span : span.subspan(begin, end - begin);
+}
+}
+
 struct Method {
 private:
     const char* name_;
-    std::vector<std::shared_ptr<MethodFunc>> funcs_;
+    // next to each other in the metadata arena
+    std::span<const MethodFunc* const> funcs_;
+
+    // static and instance calls resolve differently, so they are cached separately
+    detail::OverloadCache staticCache_;
+    detail::OverloadCache instanceCache_;
+
+    /// Index of the first function 'filter' accepts which can be invoked with 'args'.
+    /// The arguments only get checked here, invoking the function does not check them again.
+    template <typename Filter>
+    [[nodiscard]]
+    size_t Resolve(const detail::OverloadCache& cache, const ArgumentSpan args, const Filter& filter) const {
+        // nothing to choose from, checking the arguments once is cheaper than hashing them
+        if (funcs_.size() == 1) {
+            if (filter(*funcs_.front()) && funcs_.front()->CanInvokeWithArgs(args)) {
+                return 0;
+            }
+            return detail::OverloadCache::NotFound;
+        }
+
+        const uint64_t hash = detail::OverloadCache::Hash(args);
+        if (const size_t cached = cache.Find(hash, args); cached != detail::OverloadCache::NotFound) {
+            return cached;
+        }
+
+        for (size_t i = 0; i < funcs_.size(); ++i) {
+            if (!filter(*funcs_[i]) || !funcs_[i]->CanInvokeWithArgs(args)) {
+                continue;
+            }
+
+            cache.Insert(hash, args, i);
+            return i;
+        }
+        return detail::OverloadCache::NotFound;
+    }
 
 public:
     Method(const MethodData& data)
-        : name_(data.name), funcs_(data.funcs) {}
+        : name_(data.name),
+          funcs_(detail::MetadataArena().CreateRange(std::span<const MethodFunc* const>(data.funcs))) {}
+
+    // the copy starts with an empty cache
+    Method(const Method& other)
+        : name_(other.name_), funcs_(other.funcs_) {}
+
+    Method& operator=(const Method&) = delete;
 
     [[nodiscard]]
     const char* GetName() const {
@@ -22,37 +110,291 @@ public:
     }
 
     [[nodiscard]]
-    const std::vector<std::shared_ptr<MethodFunc>>& GetFunctions() const {
+    std::span<const MethodFunc* const> GetFunctions() const {
         return funcs_;
     }
 
     [[nodiscard]]
-    std::shared_ptr<MethodFunc> GetFunction(const size_t index) const {
+    const MethodFunc* GetFunction(const size_t index) const {
         return funcs_[index];
     }
 
     [[nodiscard]]
-    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const ArgumentList& args) const {
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const ArgumentSpan args) const {
+        const size_t index = Resolve(staticCache_, args, [](const MethodFunc& func) {
+            return func.IsStatic();
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+
+        // resolving already checked the arguments
+        return funcs_[index]->InvokeUnchecked(Variant::Void(), args);
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const ArgumentSpan args) const {
+        const size_t index = Resolve(instanceCache_, args, [](const MethodFunc&) {
+            return true;
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+
+        return funcs_[index]->InvokeUnchecked(obj, args);
+    }
+
+    /// Same as 'Invoke', but writes the result into 'slot' instead of returning a new variant.
+    /// A slot already holding a value of the return type is assigned to, so calling this in a loop
+    /// with the same slot does not create a variant per call.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeInto(const ArgumentSpan args, Variant& slot) const {
+        const size_t index = Resolve(staticCache_, args, [](const MethodFunc& func) {
+            return func.IsStatic();
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+
+        return funcs_[index]->InvokeUncheckedInto(Variant::Void(), args, slot);
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeInto(const Variant& obj, const ArgumentSpan args, Variant& slot) const {
+        const size_t index = Resolve(instanceCache_, args, [](const MethodFunc&) {
+            return true;
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+
+        return funcs_[index]->InvokeUncheckedInto(obj, args, slot);
+    }
+
+    /// Writes the result into 'out', which has to be of the decayed return type.
+    template <typename R>
+        requires (!std::is_same_v<R, Variant>)
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeInto(const ArgumentSpan args, R& out) const {
+        Variant slot = TRY(Variant::Create<R&>(out));
+        return InvokeInto(args, slot);
+    }
+
+    template <typename R>
+        requires (!std::is_same_v<R, Variant>)
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeInto(const Variant& obj, const ArgumentSpan args, R& out) const {
+        Variant slot = TRY(Variant::Create<R&>(out));
+        return InvokeInto(obj, args, slot);
+    }
+
+    /// Invokes on every object of 'instances' with the same 'args', which are resolved and checked once.
+    /// The objects are then called on directly one after another, nothing is invoked if 'T' is of the wrong type.
+    /// Unless 'results' is empty, the result for each object is written into the slot at its index
+    /// like 'InvokeInto' does, so it needs at least as many slots as there are objects.
+    template <typename T>
+        requires (!std::is_same_v<std::remove_cv_t<T>, Variant>)
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeBatch(const std::span<T> instances, const ArgumentSpan args,
+                                                                 const std::span<Variant> results = {}) const {
+        const size_t index = Resolve(instanceCache_, args, [](const MethodFunc&) {
+            return true;
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+        if (!results.empty() && results.size() < instances.size()) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+        }
+        if (instances.empty()) {
+            return {};
+        }
+
+        const Variant first = TRY(Variant::Create<T&>(instances.front()));
+        RESCPP_TRY_IMPL(funcs_[index]->InvokeBatchUnchecked(first, sizeof(T), instances.size(), args, results, {}), {
+                        return rescpp::fail(result_.error().error);
+                        });
+        return {};
+    }
+
+    /// Same as the typed 'InvokeBatch', but for objects held by variants.
+    /// Every object is checked, all of them before the first one is invoked on.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeBatch(const std::span<const Variant> instances, const ArgumentSpan args,
+                                                                 const std::span<Variant> results = {}) const {
+        const size_t index = Resolve(instanceCache_, args, [](const MethodFunc&) {
+            return true;
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+        if (!results.empty() && results.size() < instances.size()) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+        }
+
+        RESCPP_TRY_IMPL(funcs_[index]->InvokeBatchUnchecked(instances, args, results, {}), {
+                        return rescpp::fail(result_.error().error);
+                        });
+        return {};
+    }
+
+    /// Same as 'InvokeBatch', but spreads the instances over the threads of 'pool' in chunks.
+    /// Without 'errors', invoking stops at the first error within a chunk and the error of the lowest index is returned.
+    /// Chunk boundaries do not depend on the scheduling, so neither does which instances got invoked on.
+    /// With 'errors', which needs a slot per instance, every instance is invoked on and gets its own error.
+    /// An exception thrown by the method is rethrown here, see 'ThreadPool::ParallelFor'.
+    template <typename T>
+        requires (!std::is_same_v<std::remove_cv_t<T>, Variant>)
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> InvokeParallel(ThreadPool& pool, const std::span<T> instances, const ArgumentSpan args,
+                                                                   const std::span<Variant> results = {},
+                                                                   const std::span<std::optional<FunctionWrapperInvokeError>> errors = {}) const {
+        const size_t index = Resolve(instanceCache_, args, [](const MethodFunc&) {
+            return true;
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+        if ((!results.empty() && results.size() < instances.size()) || (!errors.empty() && errors.size() < instances.size())) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+        }
+        if (instances.empty()) {
+            return {};
+        }
+
+        // all instances are of the same type, so checking one checks them all
+        const MethodFunc& func = *funcs_[index];
+        if (!func.CanInvokeOn(TRY(Variant::Create<T&>(instances.front())))) {
+            return rescpp::fail(FunctionWrapperBatchError(FunctionWrapperInvokeError::Type::ObjectIsInvalid, 0));
+        }
+
+        detail::FirstBatchError firstError;
+        pool.ParallelFor(instances.size(), [&](const size_t begin, const size_t end) {
+            // the type got registered above already, so this does not fail
+            const Variant first = Variant::Create<T&>(instances[begin]).value();
+            auto result = func.InvokeBatchUnchecked(first, sizeof(T), end - begin, args,
+                                                    detail::SubspanOrEmpty(results, begin, end),
+                                                    detail::SubspanOrEmpty(errors, begin, end));
+            if (result.has_error()) {
+                firstError.Report(result.error(), begin);
+            }
+        });
+        return firstError.Get();
+    }
+
+    /// Same as the typed 'InvokeParallel', but for objects held by variants.
+    /// Without 'errors', all objects are checked before the first one is invoked on,
+    /// otherwise objects of the wrong type are skipped.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> InvokeParallel(ThreadPool& pool, const std::span<const Variant> instances, const ArgumentSpan args,
+                                                                   const std::span<Variant> results = {},
+                                                                   const std::span<std::optional<FunctionWrapperInvokeError>> errors = {}) const {
+        const size_t index = Resolve(instanceCache_, args, [](const MethodFunc&) {
+            return true;
+        });
+        if (index == detail::OverloadCache::NotFound) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+        }
+        if ((!results.empty() && results.size() < instances.size()) || (!errors.empty() && errors.size() < instances.size())) {
+            return rescpp::fail(FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+        }
+
+        const MethodFunc& func = *funcs_[index];
+        detail::FirstBatchError firstError;
+        if (errors.empty()) {
+            pool.ParallelFor(instances.size(), [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (!func.CanInvokeOn(instances[i])) {
+                        firstError.Report({ FunctionWrapperInvokeError::Type::ObjectIsInvalid, i });
+                        return;
+                    }
+                }
+            });
+            TRY(firstError.Get());
+        }
+
+        pool.ParallelFor(instances.size(), [&](const size_t begin, const size_t end) {
+            auto result = func.InvokeBatchUnchecked(instances.subspan(begin, end - begin), args,
+                                                    detail::SubspanOrEmpty(results, begin, end),
+                                                    detail::SubspanOrEmpty(errors, begin, end));
+            if (result.has_error()) {
+                firstError.Report(result.error(), begin);
+            }
+        });
+        return firstError.Get();
+    }
+
+    // braced lists live on the stack, unlike a temporary 'ArgumentList'
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const std::initializer_list<Variant> args) const {
+        return Invoke(ArgumentSpan(args.begin(), args.size()));
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const std::initializer_list<Variant> args) const {
+        return Invoke(obj, ArgumentSpan(args.begin(), args.size()));
+    }
+
+    /// Invokes with native arguments, which are referred to or copied inline instead of allocated.
+    /// 'obj' can be a 'Variant' or the object itself, as can every argument.
+    /// Their wrapper kinds follow from their static types, only the function is picked at runtime,
+    /// through the same cache as invoking with variants.
+    template <typename Obj, typename... Args>
+        requires (!std::is_convertible_v<Obj, ArgumentSpan>
+            && !(sizeof...(Args) == 1 && (std::is_convertible_v<Args, ArgumentSpan> && ...)))
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(Obj&& obj, Args&&... args) const {
+        const Variant object = TRY(detail::MakeObjectView<Obj>(std::forward<Obj>(obj)));
+        ArgumentPack<sizeof...(Args)> pack;
+        if constexpr (sizeof...(Args) > 0) {
+            TRY(detail::PushArgumentViews(pack, std::forward<Args>(args)...));
+        }
+        return Invoke(object, pack.Span());
+    }
+
+    /// Resolves the function to invoke with arguments of 'signature' once,
+    /// so calling it repeatedly does not need to resolve or check anything.
+    [[nodiscard]]
+    rescpp::result<PreparedCall, FunctionWrapperInvokeError> Prepare(const ArgumentSignature& signature) const {
         for (const auto& func : funcs_) {
-            if (!func->IsStatic() && !func->CanInvokeWithArgs(args)) {
-                continue;
+            if (func->CanInvokeWith(signature)) {
+                return PreparedCall(func, signature);
             }
-            return func->Invoke(Variant::Void(), args);
         }
 
         return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
     }
 
+    template <typename... Args>
     [[nodiscard]]
-    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const ArgumentList& args) const {
+    rescpp::result<PreparedCall, FunctionWrapperInvokeError> Prepare() const {
+        return Prepare(TRY(ArgumentSignature::Of<Args...>()));
+    }
+
+    /// Typed callable of the first function whose signature is exactly 'Signature'.
+    /// Member functions take their object as first parameter.
+    template <typename Signature>
+    [[nodiscard]]
+    std::optional<Delegate<Signature>> As() const noexcept {
         for (const auto& func : funcs_) {
-            if (!func->CanInvokeWithArgs(args)) {
-                continue;
+            if (auto delegate = func->template As<Signature>()) {
+                return delegate;
             }
-            return func->Invoke(obj, args);
         }
+        return std::nullopt;
+    }
 
-        return rescpp::fail(FunctionWrapperInvokeError::Type::NoCompatibleFunctionFound);
+    /// Hits and misses of the overload resolution cache of both 'Invoke' overloads.
+    /// Methods with a single function do not use the cache.
+    [[nodiscard]]
+    OverloadCacheStats GetCacheStats() const noexcept {
+        const auto static_stats = staticCache_.GetStats();
+        const auto instance_stats = instanceCache_.GetStats();
+        return {
+            .hits = static_stats.hits + instance_stats.hits,
+            .misses = static_stats.misses + instance_stats.misses,
+        };
     }
 };
 }
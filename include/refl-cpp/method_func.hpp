@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <span>
+
 #include "refl-cpp/method_func_data.hpp"
 #include "refl-cpp/function_wrapper.hpp"
 
@@ -14,10 +17,51 @@ struct MethodFunc {
     virtual rescpp::result<const std::vector<ArgumentInfo>&, ReflectError> GetArgs() const = 0;
 
     [[nodiscard]]
-    virtual bool CanInvokeWithArgs(const ArgumentList& args) const = 0;
+    virtual bool CanInvokeWithArgs(const ArgumentSpan args) const = 0;
+
+    [[nodiscard]]
+    virtual bool CanInvokeWith(const ArgumentSignature& signature) const = 0;
+
+    [[nodiscard]]
+    virtual rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const ArgumentSpan args) const = 0;
+
+    /// Expects 'CanInvokeWithArgs(args)' to be true.
+    [[nodiscard]]
+    virtual rescpp::result<Variant, FunctionWrapperInvokeError> InvokeUnchecked(const Variant& obj, const ArgumentSpan args) const = 0;
+
+    /// Same as 'InvokeUnchecked', but writes the result into 'slot', see 'FunctionWrapper::InvokeUncheckedInto'.
+    [[nodiscard]]
+    virtual rescpp::result<void, FunctionWrapperInvokeError> InvokeUncheckedInto(const Variant& obj, const ArgumentSpan args, Variant& slot) const = 0;
+
+    /// Whether 'obj' is an object this can be invoked on.
+    [[nodiscard]]
+    virtual bool CanInvokeOn(const Variant& obj) const = 0;
+
+    /// Invokes on 'count' objects laid out 'stride' bytes apart, see 'FunctionWrapper::InvokeBatchUnchecked'.
+    [[nodiscard]]
+    virtual rescpp::result<void, FunctionWrapperBatchError> InvokeBatchUnchecked(const Variant& first, size_t stride, size_t count,
+                                                                                 const ArgumentSpan args, std::span<Variant> results,
+                                                                                 std::span<std::optional<FunctionWrapperInvokeError>> errors) const = 0;
+
+    [[nodiscard]]
+    virtual rescpp::result<void, FunctionWrapperBatchError> InvokeBatchUnchecked(std::span<const Variant> objects,
+                                                                                 const ArgumentSpan args, std::span<Variant> results,
+                                                                                 std::span<std::optional<FunctionWrapperInvokeError>> errors) const = 0;
 
     [[nodiscard]]
-    virtual rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const ArgumentList& args) const = 0;
+    virtual detail::ErasedDelegate GetDelegate() const noexcept = 0;
+
+    /// Typed callable of this function, if 'Signature' is exactly its signature.
+    /// Member functions take their object as first parameter.
+    template <typename Signature>
+    [[nodiscard]]
+    std::optional<Delegate<Signature>> As() const noexcept {
+        const detail::ErasedDelegate erased = GetDelegate();
+        if (erased.signature != &detail::SignatureTag<Signature>::ID) {
+            return std::nullopt;
+        }
+        return Delegate<Signature>(erased);
+    }
 };
 
 template <typename T>
@@ -56,13 +100,52 @@ public:
     }
 
     [[nodiscard]]
-    bool CanInvokeWithArgs(const ArgumentList& args) const override {
+    bool CanInvokeWithArgs(const ArgumentSpan args) const override {
         return func_.CanInvokeWithArgs(args);
     }
 
     [[nodiscard]]
-    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const ArgumentList& args) const override {
+    bool CanInvokeWith(const ArgumentSignature& signature) const override {
+        return func_.CanInvokeWith(signature);
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const ArgumentSpan args) const override {
         return func_.Invoke(args, obj);
     }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> InvokeUnchecked(const Variant& obj, const ArgumentSpan args) const override {
+        return func_.InvokeUnchecked(args, obj);
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeUncheckedInto(const Variant& obj, const ArgumentSpan args, Variant& slot) const override {
+        return func_.InvokeUncheckedInto(args, obj, slot);
+    }
+
+    [[nodiscard]]
+    bool CanInvokeOn(const Variant& obj) const override {
+        return func_.CanInvokeOn(obj);
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> InvokeBatchUnchecked(const Variant& first, const size_t stride, const size_t count,
+                                                                         const ArgumentSpan args, const std::span<Variant> results,
+                                                                         const std::span<std::optional<FunctionWrapperInvokeError>> errors) const override {
+        return func_.InvokeBatchUnchecked(args, first, stride, count, results, errors);
+    }
+
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperBatchError> InvokeBatchUnchecked(const std::span<const Variant> objects,
+                                                                         const ArgumentSpan args, const std::span<Variant> results,
+                                                                         const std::span<std::optional<FunctionWrapperInvokeError>> errors) const override {
+        return func_.InvokeBatchUnchecked(args, objects, results, errors);
+    }
+
+    [[nodiscard]]
+    detail::ErasedDelegate GetDelegate() const noexcept override {
+        return func_.GetDelegate();
+    }
 };
 }
@@ -11,6 +11,7 @@ struct MethodFuncData {
     T ptr;
     std::vector<const char*> args{};
 
-    operator std::shared_ptr<MethodFunc>() const;
+    /// Creates the function in the metadata arena.
+    operator const MethodFunc*() const;
 };
 }
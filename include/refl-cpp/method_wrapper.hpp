@@ -10,16 +10,16 @@ struct MethodBase {
 
 protected:
     [[nodiscard]]
-    virtual Variant InvokeImpl(const ArgumentList& args, const Variant& instance) const = 0;
+    virtual Variant InvokeImpl(const ArgumentSpan args, const Variant& instance) const = 0;
 
 public:
     [[nodiscard]]
-    virtual Variant InvokeStatic(const ArgumentList& args) const {
+    virtual Variant InvokeStatic(const ArgumentSpan args) const {
         return InvokeImpl(args, Variant::Void());
     }
 
     [[nodiscard]]
-    virtual Variant Invoke(const Variant& instance, const ArgumentList& args) const {
+    virtual Variant Invoke(const Variant& instance, const ArgumentSpan args) const {
         return InvokeImpl(args, instance);
     }
 };
@@ -35,12 +35,12 @@ public:
         : func_(func), argsNames_(argsNames) {}
 
     [[nodiscard]]
-    bool CanInvokeWithArgs(const ArgumentList& args) const {
+    bool CanInvokeWithArgs(const ArgumentSpan args) const {
         return func_.CanInvokeWithArgs(args);
     }
 
     [[nodiscard]]
-    Variant InvokeImpl(const ArgumentList& args, const Variant& instance) const override {
+    Variant InvokeImpl(const ArgumentSpan args, const Variant& instance) const override {
         return func_.Invoke(args, instance);
     }
 };
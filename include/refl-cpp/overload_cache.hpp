@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+
+#include "refl-cpp/variant.hpp"
+#include "refl-cpp/argument.hpp"
+#include "refl-cpp/argument_signature.hpp"
+
+namespace ReflCpp {
+struct OverloadCacheStats {
+    uint64_t hits;
+    uint64_t misses;
+};
+
+namespace detail {
+constexpr uint64_t HashArgumentKey(uint64_t hash, const ArgumentKey key) noexcept {
+    hash ^= (static_cast<uint64_t>(key.type.Value()) << 8) | static_cast<uint8_t>(key.wrapper);
+    return hash * 1099511628211ull;
+}
+
+/// Maps argument shapes to the index of the function they resolved to.
+/// Lookups and inserts never lock. Entries are never replaced or freed before the cache is,
+/// so once all slots are taken further shapes are simply not cached.
+struct OverloadCache {
+private:
+    struct Entry {
+        uint64_t hash;
+        size_t func;
+        ArgumentSignature signature;
+
+        [[nodiscard]]
+        bool Matches(const uint64_t other_hash, const ArgumentSpan args) const noexcept {
+            return hash == other_hash && signature.Matches(args);
+        }
+    };
+
+    static constexpr size_t Capacity = 8;
+
+    // on a cache line of their own, so counting a lookup does not take the line
+    // the entries are read from away from other threads
+    struct alignas(64) Counters {
+        std::atomic<uint64_t> hits = 0;
+        std::atomic<uint64_t> misses = 0;
+    };
+
+    mutable std::array<std::atomic<const Entry*>, Capacity> entries_{};
+    mutable Counters counters_;
+
+    static void Count(std::atomic<uint64_t>& counter) noexcept {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    static constexpr size_t NotFound = SIZE_MAX;
+
+    OverloadCache() = default;
+
+    OverloadCache(const OverloadCache&) = delete;
+    OverloadCache& operator=(const OverloadCache&) = delete;
+
+    ~OverloadCache() {
+        for (auto& entry : entries_) {
+            delete entry.load(std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]]
+    static uint64_t Hash(const ArgumentSpan args) noexcept {
+        uint64_t hash = 14695981039346656037ull ^ args.size();
+        for (const auto& arg : args) {
+            hash = HashArgumentKey(hash, ArgumentKey::Of(arg));
+        }
+        return hash;
+    }
+
+    /// Counts a hit or a miss.
+    [[nodiscard]]
+    size_t Find(const uint64_t hash, const ArgumentSpan args) const noexcept {
+        for (size_t i = 0; i < Capacity; ++i) {
+            const Entry* entry = entries_[(hash + i) % Capacity].load(std::memory_order_acquire);
+            if (!entry) {
+                break;
+            }
+            if (entry->Matches(hash, args)) {
+                Count(counters_.hits);
+                return entry->func;
+            }
+        }
+
+        Count(counters_.misses);
+        return NotFound;
+    }
+
+    void Insert(const uint64_t hash, const ArgumentSpan args, const size_t func) const noexcept {
+        Entry* entry;
+        try {
+            entry = new Entry{ .hash = hash, .func = func, .signature = ArgumentSignature::Of(args) };
+        }
+        catch (const std::exception&) {
+            return;
+        }
+
+        for (size_t i = 0; i < Capacity; ++i) {
+            const Entry* expected = nullptr;
+            if (entries_[(hash + i) % Capacity].compare_exchange_strong(expected, entry, std::memory_order_release,
+                                                                         std::memory_order_acquire)) {
+                return;
+            }
+            if (expected->Matches(hash, args)) {
+                // another thread was faster
+                break;
+            }
+        }
+        delete entry;
+    }
+
+    [[nodiscard]]
+    OverloadCacheStats GetStats() const noexcept {
+        return {
+            .hits = counters_.hits.load(std::memory_order_relaxed),
+            .misses = counters_.misses.load(std::memory_order_relaxed),
+        };
+    }
+};
+}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <initializer_list>
+#include <utility>
+
+#include "refl-cpp/method_func.hpp"
+#include "refl-cpp/argument_signature.hpp"
+
+namespace ReflCpp {
+/// Function of a 'Method' resolved once for an argument signature.
+/// Invoking it skips overload resolution and argument checks,
+/// so the arguments have to match the signature it was prepared for.
+/// Only the object is still checked.
+struct PreparedCall {
+private:
+    const MethodFunc* func_;
+    ArgumentSignature signature_;
+
+public:
+    PreparedCall(const MethodFunc* func, ArgumentSignature signature) noexcept
+        : func_(func), signature_(std::move(signature)) {}
+
+    [[nodiscard]]
+    const MethodFunc& GetFunction() const noexcept {
+        return *func_;
+    }
+
+    [[nodiscard]]
+    const ArgumentSignature& GetSignature() const noexcept {
+        return signature_;
+    }
+
+    [[nodiscard]]
+    bool IsStatic() const {
+        return func_->IsStatic();
+    }
+
+    /// Whether 'args' are of the signature this got prepared for.
+    [[nodiscard]]
+    bool Matches(const ArgumentSpan args) const noexcept {
+        return signature_.Matches(args);
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const ArgumentSpan args) const {
+        return func_->InvokeUnchecked(Variant::Void(), args);
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const ArgumentSpan args) const {
+        return func_->InvokeUnchecked(obj, args);
+    }
+
+    /// Writes the result into 'slot', see 'Method::InvokeInto'.
+    [[nodiscard]]
+    rescpp::result<void, FunctionWrapperInvokeError> InvokeInto(const Variant& obj, const ArgumentSpan args, Variant& slot) const {
+        return func_->InvokeUncheckedInto(obj, args, slot);
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const std::initializer_list<Variant> args) const {
+        return Invoke(ArgumentSpan(args.begin(), args.size()));
+    }
+
+    [[nodiscard]]
+    rescpp::result<Variant, FunctionWrapperInvokeError> Invoke(const Variant& obj, const std::initializer_list<Variant> args) const {
+        return Invoke(obj, ArgumentSpan(args.begin(), args.size()));
+    }
+};
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "refl-cpp/reflect.hpp"
+
+namespace ReflCpp {
+struct FieldSchema {
+    std::string name;
+    /// Printed name of the field type.
+    std::string type;
+    /// What the fingerprint of the owning type covers of the field type.
+    uint64_t fingerprint = 0;
+    bool isConst = false;
+    bool isStatic = false;
+};
+
+struct BaseSchema {
+    std::string name;
+    uint64_t fingerprint = 0;
+};
+
+/// Plain copy of what a type fingerprint covers, so it can be sent to another program
+/// and compared field by field once the fingerprints disagree.
+struct TypeSchema {
+    std::string name;
+    uint64_t fingerprint = 0;
+    std::vector<BaseSchema> bases;
+    std::vector<FieldSchema> fields;
+
+    [[nodiscard]]
+    static rescpp::result<TypeSchema, ReflectError> Of(const Type& type) noexcept {
+        try {
+            TypeSchema schema{
+                .name = type.Dump(),
+                .fingerprint = type.GetFingerprint(),
+            };
+
+            for (size_t i = 0; i < type.GetBases().size(); ++i) {
+                const auto base = type.GetBase(i);
+                if (base.has_error()) {
+                    return rescpp::fail(ReflectError::CreationFailed);
+                }
+                schema.bases.push_back({
+                    .name = base.value().Dump(),
+                    .fingerprint = base.value().GetFingerprint(),
+                });
+            }
+
+            for (const Field& field : type.GetFields()) {
+                const auto field_type = TRY(field.GetType()).GetType();
+                const std::optional<uint64_t> fingerprint = Type::GetFieldFingerprint(field);
+                if (field_type.has_error() || !fingerprint.has_value()) {
+                    return rescpp::fail(ReflectError::CreationFailed);
+                }
+                schema.fields.push_back({
+                    .name = field.GetName(),
+                    .type = field_type.value().Dump(),
+                    .fingerprint = *fingerprint,
+                    .isConst = field.IsConst(),
+                    .isStatic = field.IsStatic(),
+                });
+            }
+            return schema;
+        }
+        catch (const std::exception&) {
+            return rescpp::fail(ReflectError::OutOfMemory);
+        }
+    }
+};
+
+struct SchemaDifference {
+    enum class Kind : uint8_t {
+        /// The types have different names, 'name' is the expected one.
+        Name,
+        /// A base only the expected type has, or one with another fingerprint.
+        Base,
+        /// A field only the expected type has.
+        MissingField,
+        /// A field only the actual type has.
+        ExtraField,
+        /// A field both have, with a different type.
+        FieldType,
+        /// A field both have, but const or static on one side only.
+        FieldQualifiers,
+        /// A field both have at another position.
+        FieldOrder,
+    };
+
+    Kind kind;
+    std::string name;
+
+    bool operator==(const SchemaDifference&) const = default;
+};
+
+/// Names what differs between two schemas, in the order of the expected fields followed by
+/// the extra ones. Empty when their fingerprints match.
+[[nodiscard]]
+inline std::vector<SchemaDifference> DiffSchema(const TypeSchema& expected, const TypeSchema& actual) {
+    using Kind = SchemaDifference::Kind;
+    std::vector<SchemaDifference> differences;
+
+    if (expected.name != actual.name) {
+        differences.push_back({ Kind::Name, expected.name });
+    }
+
+    for (size_t i = 0; i < expected.bases.size(); ++i) {
+        if (i >= actual.bases.size() || expected.bases[i].name != actual.bases[i].name
+            || expected.bases[i].fingerprint != actual.bases[i].fingerprint) {
+            differences.push_back({ Kind::Base, expected.bases[i].name });
+        }
+    }
+    for (size_t i = expected.bases.size(); i < actual.bases.size(); ++i) {
+        differences.push_back({ Kind::Base, actual.bases[i].name });
+    }
+
+    const auto find = [](const std::vector<FieldSchema>& fields, const std::string& name) -> std::optional<size_t> {
+        const auto it = std::ranges::find(fields, name, &FieldSchema::name);
+        if (it == fields.end()) {
+            return std::nullopt;
+        }
+        return static_cast<size_t>(it - fields.begin());
+    };
+
+    // positions only count among the fields both have, so one missing field is not reported as every later one moving
+    size_t shared = 0;
+    std::vector<size_t> shared_positions;
+    for (const FieldSchema& field : actual.fields) {
+        shared_positions.push_back(find(expected.fields, field.name).has_value() ? shared++ : SIZE_MAX);
+    }
+
+    shared = 0;
+    for (const FieldSchema& field : expected.fields) {
+        const std::optional<size_t> index = find(actual.fields, field.name);
+        if (!index.has_value()) {
+            differences.push_back({ Kind::MissingField, field.name });
+            continue;
+        }
+
+        const FieldSchema& other = actual.fields[*index];
+        if (field.type != other.type || field.fingerprint != other.fingerprint) {
+            differences.push_back({ Kind::FieldType, field.name });
+        }
+        if (field.isConst != other.isConst || field.isStatic != other.isStatic) {
+            differences.push_back({ Kind::FieldQualifiers, field.name });
+        }
+        if (shared_positions[*index] != shared++) {
+            differences.push_back({ Kind::FieldOrder, field.name });
+        }
+    }
+
+    for (const FieldSchema& field : actual.fields) {
+        if (!find(expected.fields, field.name).has_value()) {
+            differences.push_back({ Kind::ExtraField, field.name });
+        }
+    }
+    return differences;
+}
+
+/// Compares 'expected' and 'actual' with a single fingerprint compare and only builds their schemas
+/// to name the differences if that fails.
+[[nodiscard]]
+inline rescpp::result<std::vector<SchemaDifference>, ReflectError> DiffSchema(const Type& expected, const Type& actual) noexcept {
+    if (expected.GetFingerprint() == actual.GetFingerprint() && expected.GetFingerprint() != 0) {
+        return std::vector<SchemaDifference>{};
+    }
+
+    const auto expected_schema = TypeSchema::Of(expected);
+    if (expected_schema.has_error()) {
+        return rescpp::fail(expected_schema.error());
+    }
+    const auto actual_schema = TypeSchema::Of(actual);
+    if (actual_schema.has_error()) {
+        return rescpp::fail(actual_schema.error());
+    }
+
+    try {
+        return DiffSchema(expected_schema.value(), actual_schema.value());
+    }
+    catch (const std::exception&) {
+        return rescpp::fail(ReflectError::OutOfMemory);
+    }
+}
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "refl-cpp/reflect.hpp"
+#include "refl-cpp/type_plan_cache.hpp"
+#include "refl-cpp/common/unreachable.hpp"
+
+namespace ReflCpp {
+enum class SoAError : uint8_t {
+    /// The type is not standard layout, so none of its field offsets are known.
+    Unsupported,
+
+    ReflectMaxLimitReached,
+    ReflectCreationFailed,
+    ReflectIDCollision,
+
+    OutOfMemory,
+};
+}
+
+template <>
+struct ::rescpp::type_converter<ReflCpp::ReflectError, ReflCpp::SoAError> {
+    static ReflCpp::SoAError convert(const ReflCpp::ReflectError& error) noexcept {
+        switch (error) {
+            case ReflCpp::ReflectError::MaxLimitReached:
+                return ReflCpp::SoAError::ReflectMaxLimitReached;
+            case ReflCpp::ReflectError::CreationFailed:
+                return ReflCpp::SoAError::ReflectCreationFailed;
+            case ReflCpp::ReflectError::OutOfMemory:
+                return ReflCpp::SoAError::OutOfMemory;
+            case ReflCpp::ReflectError::IDCollision:
+                return ReflCpp::SoAError::ReflectIDCollision;
+        }
+        ReflCpp::unreachable<true>();
+    }
+};
+
+namespace ReflCpp {
+namespace detail {
+template <size_t Size>
+void StridedCopyFixed(std::byte* dst, const size_t dstStride, const std::byte* src, const size_t srcStride, const size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        std::memcpy(dst + i * dstStride, src + i * srcStride, Size);
+    }
+}
+
+/// Copies 'count' elements of 'size' bytes between two strided arrays.
+/// Common sizes get a loop with a constant size, so every element is a single load and store
+/// the compiler can vectorize.
+inline void StridedCopy(std::byte* dst, const size_t dstStride, const std::byte* src, const size_t srcStride,
+                        const size_t size, const size_t count) noexcept {
+    if (dstStride == size && srcStride == size) {
+        std::memcpy(dst, src, size * count);
+        return;
+    }
+
+    switch (size) {
+        case 1:
+            return StridedCopyFixed<1>(dst, dstStride, src, srcStride, count);
+        case 2:
+            return StridedCopyFixed<2>(dst, dstStride, src, srcStride, count);
+        case 4:
+            return StridedCopyFixed<4>(dst, dstStride, src, srcStride, count);
+        case 8:
+            return StridedCopyFixed<8>(dst, dstStride, src, srcStride, count);
+        case 16:
+            return StridedCopyFixed<16>(dst, dstStride, src, srcStride, count);
+        default:
+            for (size_t i = 0; i < count; ++i) {
+                std::memcpy(dst + i * dstStride, src + i * srcStride, size);
+            }
+    }
+}
+}
+
+/// A field of the transposed type, stored for every instance back to back.
+struct SoAColumn {
+    const Field* field;
+
+    /// Byte offset within an instance.
+    size_t offset;
+    size_t size;
+};
+
+/// Which fields of a type get transposed, built once per type.
+/// Only fields with a known offset and a trivially copyable type are part of it,
+/// so moving them is nothing but byte copies.
+struct SoAPlan {
+    TypeID type = TypeID::Invalid();
+    size_t stride = 0;
+
+    /// Alignment of every column, at least a cache line.
+    size_t alignment = 64;
+
+    std::vector<SoAColumn> columns;
+
+    template <typename Cache>
+    [[nodiscard]]
+    static rescpp::result<void, SoAError> Build(Cache&, const Type& type, SoAPlan& plan) noexcept {
+        const TypeLayout& layout = type.GetLayout();
+        if (layout.size == 0 || !layout.standardLayout) {
+            return rescpp::fail(SoAError::Unsupported);
+        }
+
+        plan.type = type.GetID();
+        plan.stride = layout.size;
+
+        for (const Field& field : type.GetFields()) {
+            const std::optional<size_t> offset = field.GetOffset();
+            if (!offset.has_value() || !field.GetLayout().triviallyCopyable) {
+                continue;
+            }
+
+            try {
+                plan.columns.push_back({
+                    .field = &field,
+                    .offset = *offset,
+                    .size = field.GetSize(),
+                });
+            }
+            catch (const std::exception&) {
+                return rescpp::fail(SoAError::OutOfMemory);
+            }
+            plan.alignment = std::max(plan.alignment, field.GetLayout().alignment);
+        }
+        return {};
+    }
+
+    [[nodiscard]]
+    std::optional<size_t> FindColumn(const std::string_view name) const noexcept {
+        for (size_t i = 0; i < columns.size(); ++i) {
+            if (name == columns[i].field->GetName()) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+namespace detail {
+using SoAPlanCache = TypePlanCache<SoAPlan, SoAError>;
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<const SoAPlan&, SoAError> GetSoAPlan() noexcept {
+    return SoAPlanCache::Instance().Get<T>();
+}
+}
+
+/// Instances of 'T' transposed into one contiguous column per field of its 'SoAPlan'.
+/// Fields outside the plan are not stored, and types without standard layout are not supported.
+template <typename T>
+struct StructOfArrays {
+private:
+    struct AlignedDelete {
+        size_t alignment;
+
+        void operator()(std::byte* ptr) const noexcept {
+            ::operator delete[](ptr, std::align_val_t(alignment));
+        }
+    };
+
+    const SoAPlan* plan_;
+    size_t size_;
+    std::unique_ptr<std::byte[], AlignedDelete> data_;
+    std::vector<std::byte*> columns_;
+
+    StructOfArrays(const SoAPlan& plan, const size_t size)
+        : plan_(&plan),
+          size_(size),
+          data_(nullptr, AlignedDelete{ plan.alignment }) {
+        std::vector<size_t> starts;
+        starts.reserve(plan.columns.size());
+
+        size_t total = 0;
+        for (const auto& column : plan.columns) {
+            starts.push_back(total);
+            total += (column.size * size + plan.alignment - 1) / plan.alignment * plan.alignment;
+        }
+
+        data_.reset(static_cast<std::byte*>(::operator new[](std::max<size_t>(total, 1), std::align_val_t(plan.alignment))));
+        columns_.reserve(starts.size());
+        for (const size_t start : starts) {
+            columns_.push_back(data_.get() + start);
+        }
+    }
+
+public:
+    [[nodiscard]]
+    static rescpp::result<StructOfArrays, SoAError> Create(std::span<const T> objects) noexcept {
+        const SoAPlan& plan = TRY(detail::GetSoAPlan<T>());
+        try {
+            StructOfArrays soa(plan, objects.size());
+            const auto* base = reinterpret_cast<const std::byte*>(objects.data());
+            for (size_t i = 0; i < plan.columns.size(); ++i) {
+                const SoAColumn& column = plan.columns[i];
+                detail::StridedCopy(soa.columns_[i], column.size, base + column.offset, plan.stride,
+                                    column.size, objects.size());
+            }
+            return soa;
+        }
+        catch (const std::exception&) {
+            return rescpp::fail(SoAError::OutOfMemory);
+        }
+    }
+
+    [[nodiscard]]
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]]
+    const SoAPlan& GetPlan() const noexcept {
+        return *plan_;
+    }
+
+    [[nodiscard]]
+    std::span<std::byte> RawColumn(const size_t index) noexcept {
+        return { columns_[index], plan_->columns[index].size * size_ };
+    }
+
+    [[nodiscard]]
+    std::span<const std::byte> RawColumn(const size_t index) const noexcept {
+        return { columns_[index], plan_->columns[index].size * size_ };
+    }
+
+    /// Empty if the field is not part of the plan or 'F' is not its type.
+    template <typename F>
+    [[nodiscard]]
+    std::optional<std::span<F>> Column(const std::string_view name) noexcept {
+        const std::optional<size_t> index = plan_->FindColumn(name);
+        if (!index.has_value() || !plan_->columns[*index].field->IsType<F>()) {
+            return std::nullopt;
+        }
+        return std::span<F>(reinterpret_cast<F*>(columns_[*index]), size_);
+    }
+
+    template <typename F>
+    [[nodiscard]]
+    std::optional<std::span<const F>> Column(const std::string_view name) const noexcept {
+        const std::optional<size_t> index = plan_->FindColumn(name);
+        if (!index.has_value() || !plan_->columns[*index].field->IsType<F>()) {
+            return std::nullopt;
+        }
+        return std::span<const F>(reinterpret_cast<const F*>(columns_[*index]), size_);
+    }
+
+    /// Writes the columns back into 'objects', which needs the same size.
+    /// Const fields and fields outside the plan are left as they are.
+    [[nodiscard]]
+    bool CopyTo(std::span<T> objects) const noexcept {
+        if (objects.size() != size_) {
+            return false;
+        }
+
+        auto* base = reinterpret_cast<std::byte*>(objects.data());
+        for (size_t i = 0; i < plan_->columns.size(); ++i) {
+            const SoAColumn& column = plan_->columns[i];
+            if (column.field->IsConst()) {
+                continue;
+            }
+            detail::StridedCopy(base + column.offset, plan_->stride, columns_[i], column.size,
+                                column.size, size_);
+        }
+        return true;
+    }
+
+    [[nodiscard]]
+    std::vector<T> ToVector() const
+        requires std::default_initializable<T> {
+        std::vector<T> objects(size_);
+        (void)CopyTo(objects);
+        return objects;
+    }
+};
+
+template <typename T>
+[[nodiscard]]
+rescpp::result<StructOfArrays<T>, SoAError> ToSoA(const std::vector<T>& objects) noexcept {
+    return StructOfArrays<T>::Create(objects);
+}
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ReflCpp {
+struct ThreadPoolConfig {
+    /// Threads working on a job, including the one starting it.
+    /// Zero uses one per hardware thread.
+    size_t threads = 0;
+
+    /// Indices handed out at once, a chunk is the smallest unit of work which can be stolen.
+    size_t chunkSize = 256;
+};
+
+/// Persistent threads running parallel loops over index ranges.
+/// Every job is split into chunks of fixed boundaries, which get spread evenly over the threads.
+/// A thread done with its own chunks steals the last ones of the others.
+/// The thread calling 'ParallelFor' works on the job too and only one job runs at a time,
+/// so a job must not start another one on the same pool.
+/// An exception thrown by a chunk is handed to the caller of 'ParallelFor'.
+struct ThreadPool {
+private:
+    using Body = void(*)(const void* context, size_t begin, size_t end);
+
+    /// Packed '[begin, end)' chunk range, so taking from either side is a single CAS.
+    /// Each half has 32 bits, so a job has at most 'MaxChunks' chunks.
+    struct alignas(64) Queue {
+        std::atomic<uint64_t> range = 0;
+
+        static constexpr uint64_t Pack(const uint64_t begin, const uint64_t end) noexcept {
+            return begin << 32 | end;
+        }
+
+        /// Takes the first chunk, which the owning thread does.
+        [[nodiscard]]
+        bool PopFront(size_t& chunk) noexcept {
+            uint64_t current = range.load(std::memory_order_relaxed);
+            while (true) {
+                const uint64_t begin = current >> 32;
+                const uint64_t end = current & 0xFFFFFFFF;
+                if (begin >= end) {
+                    return false;
+                }
+                if (range.compare_exchange_weak(current, Pack(begin + 1, end), std::memory_order_relaxed)) {
+                    chunk = begin;
+                    return true;
+                }
+            }
+        }
+
+        /// Takes the last chunk, which other threads do.
+        [[nodiscard]]
+        bool PopBack(size_t& chunk) noexcept {
+            uint64_t current = range.load(std::memory_order_relaxed);
+            while (true) {
+                const uint64_t begin = current >> 32;
+                const uint64_t end = current & 0xFFFFFFFF;
+                if (begin >= end) {
+                    return false;
+                }
+                if (range.compare_exchange_weak(current, Pack(begin, end - 1), std::memory_order_relaxed)) {
+                    chunk = end - 1;
+                    return true;
+                }
+            }
+        }
+    };
+
+    size_t threadCount_;
+    size_t chunkSize_;
+    std::unique_ptr<Queue[]> queues_;
+    std::vector<std::thread> threads_;
+
+    // serializes jobs
+    std::mutex jobMutex_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_ = 0;
+    size_t running_ = 0;
+    bool stop_ = false;
+
+    // current job, written before 'generation_' is increased
+    Body body_ = nullptr;
+    const void* context_ = nullptr;
+    size_t count_ = 0;
+    size_t jobChunkSize_ = 0;
+
+    // first exception of the current job, guarded by 'mutex_'
+    std::exception_ptr exception_;
+    // set once a chunk threw, so the chunks not started yet are skipped
+    std::atomic<bool> failed_ = false;
+
+    void RunChunk(const size_t chunk) noexcept {
+        if (failed_.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        const size_t begin = chunk * jobChunkSize_;
+        try {
+            body_(context_, begin, std::min(begin + jobChunkSize_, count_));
+        }
+        catch (...) {
+            std::lock_guard lock(mutex_);
+            if (!exception_) {
+                exception_ = std::current_exception();
+            }
+            failed_.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    void Work(const size_t self) noexcept {
+        size_t chunk;
+        while (queues_[self].PopFront(chunk)) {
+            RunChunk(chunk);
+        }
+
+        // chunks are never added during a job, so once every queue is empty the job is done
+        for (size_t offset = 1; offset < threadCount_; ++offset) {
+            auto& victim = queues_[(self + offset) % threadCount_];
+            while (victim.PopBack(chunk)) {
+                RunChunk(chunk);
+            }
+        }
+    }
+
+    void WorkerLoop(const size_t self) {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock lock(mutex_);
+                wake_.wait(lock, [&] {
+                    return stop_ || generation_ != seen;
+                });
+                if (stop_) {
+                    return;
+                }
+                seen = generation_;
+            }
+
+            Work(self);
+
+            std::lock_guard lock(mutex_);
+            if (--running_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+public:
+    static constexpr size_t MaxChunks = 0xFFFFFFFF;
+
+    explicit ThreadPool(const ThreadPoolConfig& config = {})
+        : threadCount_(config.threads != 0 ? config.threads : std::max(1u, std::thread::hardware_concurrency())),
+          chunkSize_(std::max<size_t>(config.chunkSize, 1)),
+          queues_(std::make_unique<Queue[]>(threadCount_)) {
+        threads_.reserve(threadCount_ - 1);
+        for (size_t i = 1; i < threadCount_; ++i) {
+            threads_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    [[nodiscard]]
+    size_t GetThreadCount() const noexcept {
+        return threadCount_;
+    }
+
+    [[nodiscard]]
+    size_t GetChunkSize() const noexcept {
+        return chunkSize_;
+    }
+
+    /// Chunk size a job over 'count' indices is split by, which is only larger than
+    /// the configured one if it would make more than 'MaxChunks' chunks.
+    [[nodiscard]]
+    size_t GetChunkSize(const size_t count) const noexcept {
+        return std::max(chunkSize_, count / MaxChunks + (count % MaxChunks != 0));
+    }
+
+    /// Calls 'body(begin, end)' for every chunk of '[0, count)' and returns once all of them are done.
+    /// Chunk boundaries only depend on 'count' and the chunk size, not on which thread runs them.
+    /// If 'body' throws, the chunks not started yet are skipped and the first exception
+    /// is rethrown once every thread is done.
+    template <typename F>
+    void ParallelFor(const size_t count, const F& body) {
+        if (count == 0) {
+            return;
+        }
+
+        const size_t chunk_size = GetChunkSize(count);
+        const size_t chunks = count / chunk_size + (count % chunk_size != 0);
+        if (chunks == 1 || threadCount_ == 1) {
+            for (size_t begin = 0; begin < count; begin += chunk_size) {
+                body(begin, std::min(begin + chunk_size, count));
+            }
+            return;
+        }
+
+        std::lock_guard job(jobMutex_);
+
+        body_ = [](const void* context, const size_t begin, const size_t end) {
+            (*static_cast<const F*>(context))(begin, end);
+        };
+        context_ = &body;
+        count_ = count;
+        jobChunkSize_ = chunk_size;
+        exception_ = nullptr;
+        failed_.store(false, std::memory_order_relaxed);
+        for (size_t i = 0; i < threadCount_; ++i) {
+            queues_[i].range.store(Queue::Pack(chunks * i / threadCount_, chunks * (i + 1) / threadCount_),
+                                   std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard lock(mutex_);
+            ++generation_;
+            running_ = threadCount_ - 1;
+        }
+        wake_.notify_all();
+
+        Work(0);
+
+        std::unique_lock lock(mutex_);
+        done_.wait(lock, [&] {
+            return running_ == 0;
+        });
+        if (exception_) {
+            std::rethrow_exception(std::exchange(exception_, nullptr));
+        }
+    }
+};
+}
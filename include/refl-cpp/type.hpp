@@ -1,10 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <optional>
 #include <ostream>
 #include <sstream>
 #include <algorithm>
+#include <string_view>
 
 #include "refl-cpp/declare_reflect.hpp"
 #include "refl-cpp/type_data.hpp"
@@ -12,6 +15,7 @@
 #include "refl-cpp/method.hpp"
 #include "refl-cpp/field.hpp"
 #include "refl-cpp/type_flags.hpp"
+#include "refl-cpp/common/name_index.hpp"
 
 namespace ReflCpp {
 struct Type {
@@ -19,16 +23,52 @@ private:
     const TypeID id_;
     const TypeData* data_;
     const ReflectPrintFunc printFunc_;
+    const TypeLayout layout_;
+
+    const detail::NameIndex fieldIndex_;
+    const detail::NameIndex methodIndex_;
+
+    // 0 until computed
+    mutable std::atomic<uint64_t> fingerprint_ = 0;
+
+    [[nodiscard]]
+    std::optional<uint64_t> ComputeFingerprint() const noexcept {
+        uint64_t hash = GetNameHash();
+
+        for (const TypeID base : data_->bases) {
+            const auto base_type = base.GetType();
+            if (base_type.has_error()) {
+                return std::nullopt;
+            }
+            hash = detail::CombineHash(hash, base_type.value().GetFingerprint());
+        }
+
+        for (const Field& field : data_->fields) {
+            const std::optional<uint64_t> field_fingerprint = GetFieldFingerprint(field);
+            if (!field_fingerprint.has_value()) {
+                return std::nullopt;
+            }
+            hash = detail::CombineHash(hash, detail::HashName(field.GetName()));
+            hash = detail::CombineHash(hash, field.IsConst() | field.IsStatic() << 1);
+            hash = detail::CombineHash(hash, *field_fingerprint);
+        }
+
+        // 0 marks a fingerprint that was not computed yet
+        return hash != 0 ? hash : 1;
+    }
 
 public:
     Type() = delete;
     Type(const Type&) = delete;
     Type(Type&&) = delete;
 
-    Type(const TypeID id, const TypeData* data, const TypeOptions& options) noexcept
+    Type(const TypeID id, const TypeData* data, const TypeOptions& options)
         : id_(id),
           data_(data),
-          printFunc_(options.printFunc) {}
+          printFunc_(options.printFunc),
+          layout_(options.layout),
+          fieldIndex_(data->fields, [](const Field& field) { return field.GetName(); }),
+          methodIndex_(data->methods, [](const Method& method) { return method.GetName(); }) {}
 
     [[nodiscard]]
     TypeID GetID() const noexcept {
@@ -68,6 +108,15 @@ public:
         return data_->bases[index].GetType();
     }
 
+    /// Byte offset of a base within an instance, only known if it was given in 'TypeData::baseOffsets'.
+    [[nodiscard]]
+    std::optional<size_t> GetBaseOffset(const size_t index) const noexcept {
+        if (index >= data_->baseOffsets.size()) {
+            return std::nullopt;
+        }
+        return data_->baseOffsets[index];
+    }
+
     [[nodiscard]]
     bool HasInners() const noexcept {
         return !data_->inners.empty();
@@ -98,6 +147,65 @@ public:
         return data_->flags;
     }
 
+    [[nodiscard]]
+    const TypeLayout& GetLayout() const noexcept {
+        return layout_;
+    }
+
+    /// Hash of the namespace, name and flags of this type and of its inner types.
+    [[nodiscard]]
+    uint64_t GetNameHash() const noexcept {
+        uint64_t hash = detail::CombineHash(detail::HashName(GetNamespace()), detail::HashName(GetName()));
+        hash = detail::CombineHash(hash, GetFlags().Value());
+        for (const TypeID inner : data_->inners) {
+            const auto inner_type = inner.GetType();
+            hash = detail::CombineHash(hash, inner_type.has_error() ? 0 : inner_type.value().GetNameHash());
+        }
+        return hash;
+    }
+
+    /// Structural hash of the name hash, the fingerprints of the bases and the name, qualifiers
+    /// and type of every field in order. It does not depend on type ids or the layout,
+    /// so two programs reflecting a type the same way agree on it.
+    /// Computed on first use, 0 if a base or field type fails to register.
+    [[nodiscard]]
+    uint64_t GetFingerprint() const noexcept {
+        if (const uint64_t cached = fingerprint_.load(std::memory_order_acquire); cached != 0) {
+            return cached;
+        }
+
+        // the same value on every thread, so racing to compute it is harmless
+        const std::optional<uint64_t> fingerprint = ComputeFingerprint();
+        if (!fingerprint.has_value()) {
+            // a field type failed to register, which is retried on the next call
+            return 0;
+        }
+        fingerprint_.store(*fingerprint, std::memory_order_release);
+        return *fingerprint;
+    }
+
+    /// What the fingerprint of a type covers of 'field's type.
+    /// Static fields, pointers and references only cover the name hash of their type,
+    /// which keeps types referring to themselves finite.
+    [[nodiscard]]
+    static std::optional<uint64_t> GetFieldFingerprint(const Field& field) noexcept {
+        const auto id = field.GetType();
+        if (id.has_error()) {
+            return std::nullopt;
+        }
+        const auto type = id.value().GetType();
+        if (type.has_error()) {
+            return std::nullopt;
+        }
+
+        const TypeFlags& flags = type.value().GetFlags();
+        if (field.IsStatic() || flags.Has(TypeFlags::IsPointer) || flags.Has(TypeFlags::IsLValueReference)
+            || flags.Has(TypeFlags::IsRValueReference)) {
+            return type.value().GetNameHash();
+        }
+        return type.value().GetFingerprint();
+    }
+
     // fields
 
     [[nodiscard]]
@@ -105,13 +213,13 @@ public:
         return data_->fields;
     }
 
-    std::optional<std::reference_wrapper<const Field>> GetField(const char* name) const noexcept {
-        for (const auto& field : data_->fields) {
-            if (field.GetName() == name) {
-                return field;
-            }
+    [[nodiscard]]
+    std::optional<std::reference_wrapper<const Field>> GetField(const std::string_view name) const noexcept {
+        const size_t index = fieldIndex_.Find(name);
+        if (index == detail::NameIndex::NotFound) {
+            return std::nullopt;
         }
-        return std::nullopt;
+        return data_->fields[index];
     }
 
     // methods
@@ -121,13 +229,13 @@ public:
         return data_->methods;
     }
 
-    std::optional<std::reference_wrapper<const Method>> GetMethod(const char* name) const noexcept {
-        for (const auto& method : data_->methods) {
-            if (method.GetName() == name) {
-                return method;
-            }
+    [[nodiscard]]
+    std::optional<std::reference_wrapper<const Method>> GetMethod(const std::string_view name) const noexcept {
+        const size_t index = methodIndex_.Find(name);
+        if (index == detail::NameIndex::NotFound) {
+            return std::nullopt;
         }
-        return std::nullopt;
+        return data_->methods[index];
     }
 
     // utils
@@ -145,7 +253,7 @@ public:
     template <typename T>
     [[nodiscard]]
     bool Is() const noexcept {
-        return Is(ReflectID<T>());
+        return id_.Equals<T>();
     }
 
     void Print(std::ostream& stream) const {
@@ -1,20 +1,35 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include <optional>
+#include <type_traits>
 
 #include "refl-cpp/reflect_printer.hpp"
 #include "refl-cpp/field.hpp"
 #include "refl-cpp/method.hpp"
 #include "refl-cpp/type_id.hpp"
 #include "refl-cpp/type_flags.hpp"
+#include "refl-cpp/type_layout.hpp"
+#include "refl-cpp/common/unconstructed_object.hpp"
 
 namespace ReflCpp {
+/// Byte offset of the 'Base' subobject within 'Derived', for 'TypeData::baseOffsets'.
+/// Virtual bases have no fixed offset, so they are rejected.
+template <typename Derived, typename Base>
+    requires std::is_base_of_v<Base, Derived> && requires(const Base* base) { static_cast<const Derived*>(base); }
+size_t BaseOffset() noexcept {
+    const auto* object = reinterpret_cast<const Derived*>(detail::UnconstructedObject<Derived>());
+    return detail::OffsetInUnconstructed<Derived>(static_cast<const Base*>(object));
+}
+
 struct TypeData {
     const char* name = "$NONE$";
     std::optional<const char*> _namespace = std::nullopt;
 
     std::vector<TypeID> bases;
+    /// Offset of every base in the order of 'bases', bases without one can not be reached from an object.
+    std::vector<size_t> baseOffsets;
     std::vector<TypeID> inners;
 
     TypeFlags flags;
@@ -25,6 +40,7 @@ struct TypeData {
 
 struct TypeOptions {
     ReflectPrintFunc printFunc = nullptr;
+    TypeLayout layout{};
 };
 
 template <typename T>
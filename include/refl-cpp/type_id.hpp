@@ -1,10 +1,17 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <type_traits>
 
 #include "refl-cpp/declare_reflect.hpp"
+#include "refl-cpp/common/type_name.hpp"
 
 namespace ReflCpp {
+namespace detail {
+template <typename T>
+struct TypeIDCache;
+}
 
 struct TypeID {
 private:
@@ -18,28 +25,28 @@ public:
     }
 
     [[nodiscard]]
-    uint32_t Value() const noexcept {
+    constexpr uint32_t Value() const noexcept {
         return id_;
     }
 
-    operator uint32_t() const noexcept {
+    constexpr operator uint32_t() const noexcept {
         return id_;
     }
 
     constexpr TypeID(const uint32_t id) noexcept
         : id_(id) {}
 
-    bool operator==(const TypeID other) const noexcept {
+    constexpr bool operator==(const TypeID other) const noexcept {
         return id_ == other.id_;
     }
 
     [[nodiscard]]
-    bool IsValid() const noexcept {
+    constexpr bool IsValid() const noexcept {
         return this->id_ != invalid_;
     }
 
     [[nodiscard]]
-    bool IsInvalid() const noexcept {
+    constexpr bool IsInvalid() const noexcept {
         return this->id_ == invalid_;
     }
 
@@ -53,17 +60,73 @@ public:
     }
 
     [[nodiscard]]
-    bool Equals(const TypeID& other) const noexcept {
+    constexpr bool Equals(const TypeID& other) const noexcept {
         return id_ == other.id_;
     }
 
     template <typename T>
     [[nodiscard]]
     bool Equals() const noexcept {
+        const TypeID cached = detail::TypeIDCache<T>::Load();
+        if (cached.IsValid()) {
+            return Equals(cached);
+        }
+
         const TypeID other = RESCPP_TRY_IMPL(ReflectID<T>(), {
             return false;
         });
         return Equals(other);
     }
+
+    /// Compares against the cached id of 'T' without registering 'T'.
+    /// Only meaningful for valid ids, since an unregistered 'T' is cached as 'Invalid'
+    /// and can therefore never equal a valid id.
+    template <typename T>
+    [[nodiscard]]
+    bool EqualsCached() const noexcept {
+        return Equals(detail::TypeIDCache<T>::Load());
+    }
+};
+
+/// Id of 'T' derived from a hash of its fully qualified name.
+/// It is the same across runs and processes built with the same compiler,
+/// and is the id 'T' gets registered with if 'REFLCPP_STABLE_TYPE_IDS' is defined.
+/// The name of a type in an anonymous namespace does not tell translation units apart,
+/// so types of the same name in anonymous namespaces of different ones get the same id.
+template <typename T>
+constexpr TypeID StableTypeID() noexcept {
+    if constexpr (std::is_void_v<T>) {
+        return TypeID::Invalid();
+    }
+    else {
+        return detail::HashTypeName(detail::TypeName<T>());
+    }
+}
+
+namespace detail {
+/// Holds the id of 'T' once it got registered and 'Invalid' until then.
+/// Reading it is a single relaxed load.
+template <typename T>
+struct TypeIDCache {
+private:
+    static inline std::atomic<uint32_t> id_ = TypeID::Invalid().Value();
+
+public:
+    [[nodiscard]]
+    static TypeID Load() noexcept {
+        return id_.load(std::memory_order_relaxed);
+    }
+
+    /// Use this if the type itself gets looked up with the id afterwards,
+    /// since only then its registration is guaranteed to be visible.
+    [[nodiscard]]
+    static TypeID LoadAcquire() noexcept {
+        return id_.load(std::memory_order_acquire);
+    }
+
+    static void Store(const TypeID id) noexcept {
+        id_.store(id.Value(), std::memory_order_release);
+    }
 };
 }
+}
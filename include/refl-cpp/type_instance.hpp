@@ -7,15 +7,14 @@ namespace ReflCpp {
 template <typename T>
 struct TypeInstance {
     static rescpp::result<TypeID, ReflectError> ID() {
-        static TypeID id = TypeID::Invalid();
-        if (id.IsValid()) {
-            return id;
+        const TypeID cached = detail::TypeIDCache<T>::LoadAcquire();
+        if (cached.IsValid()) {
+            return cached;
         }
-        
+
+        // stores the id in the cache itself
         auto& database = ReflectionDatabase::Instance();
-        id = TRY(database.RegisterType<T>());
-        
-        return id;
+        return database.RegisterType<T>();
     }
 
     static rescpp::result<const Type&, ReflectError> Type() {
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ReflCpp {
+namespace detail {
+template <typename T>
+constexpr bool IsSignedInteger() noexcept {
+    if constexpr (std::is_enum_v<T>) {
+        return std::is_signed_v<std::underlying_type_t<T>>;
+    }
+    else {
+        return std::is_signed_v<T>;
+    }
+}
+}
+
+/// Object layout of a type, recorded when it gets registered.
+struct TypeLayout {
+    /// Zero for types without objects of their own, like references, functions, void and unbounded arrays.
+    size_t size = 0;
+    size_t alignment = 0;
+
+    bool standardLayout = false;
+    bool triviallyCopyable = false;
+    /// Classes without any data, which take no space as a base.
+    bool empty = false;
+
+    /// Integers and enums, whose value is an integer of 'size' bytes.
+    bool integer = false;
+    bool signedInteger = false;
+
+    template <typename T>
+    [[nodiscard]]
+    static constexpr TypeLayout Of() noexcept {
+        if constexpr (std::is_object_v<T> && !std::is_unbounded_array_v<T>) {
+            return {
+                .size = sizeof(T),
+                .alignment = alignof(T),
+                .standardLayout = std::is_standard_layout_v<T>,
+                .triviallyCopyable = std::is_trivially_copyable_v<T>,
+                .empty = std::is_empty_v<T>,
+                .integer = std::is_integral_v<T> || std::is_enum_v<T>,
+                .signedInteger = detail::IsSignedInteger<T>(),
+            };
+        }
+        else {
+            return {};
+        }
+    }
+};
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "refl-cpp/reflect.hpp"
+#include "refl-cpp/common/concurrent_id_map.hpp"
+
+namespace ReflCpp::detail {
+/// Plans derived from types, built once per TypeID and found without locking afterwards.
+/// 'Plan::Build(cache, type, plan)' fills a plan and gets the ones of nested types through 'GetLocked'.
+/// 'Error' needs an 'OutOfMemory' value.
+template <typename Plan, typename Error>
+struct TypePlanCache {
+private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Plan>> plans_;
+    ConcurrentIDMap<const Plan> lookup_;
+
+public:
+    static TypePlanCache& Instance() {
+        static TypePlanCache instance;
+        return instance;
+    }
+
+    [[nodiscard]]
+    rescpp::result<const Plan&, Error> Get(const Type& type) noexcept {
+        if (const Plan* plan = lookup_.Find(type.GetID().Value())) {
+            return *plan;
+        }
+
+        std::lock_guard lock(mutex_);
+        return GetLocked(type);
+    }
+
+    /// Same as 'Get', but remembers the plan of 'T', so later calls are a single load.
+    template <typename T>
+    [[nodiscard]]
+    rescpp::result<const Plan&, Error> Get() noexcept {
+        static std::atomic<const Plan*> cached = nullptr;
+        if (const Plan* plan = cached.load(std::memory_order_acquire)) {
+            return *plan;
+        }
+
+        const Plan& plan = TRY(Get(TRY(ReflCpp::Reflect<T>())));
+        cached.store(&plan, std::memory_order_release);
+        return plan;
+    }
+
+    /// Only for 'Plan::Build', which runs with the lock held.
+    [[nodiscard]]
+    rescpp::result<const Plan&, Error> GetLocked(const Type& type) noexcept {
+        if (const Plan* plan = lookup_.Find(type.GetID().Value())) {
+            return *plan;
+        }
+
+        std::unique_ptr<Plan> plan;
+        try {
+            plan = std::make_unique<Plan>();
+            plans_.reserve(plans_.size() + 1);
+        }
+        catch (const std::exception&) {
+            return rescpp::fail(Error::OutOfMemory);
+        }
+
+        TRY(Plan::Build(*this, type, *plan));
+
+        if (!lookup_.Insert(type.GetID().Value(), plan.get())) {
+            return rescpp::fail(Error::OutOfMemory);
+        }
+        plans_.push_back(std::move(plan));
+        return *plans_.back();
+    }
+};
+}
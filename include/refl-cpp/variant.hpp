@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
 #include "refl-cpp/type_id.hpp"
 
 namespace ReflCpp {
@@ -18,17 +23,167 @@ enum class VariantWrapperType : uint8_t {
     CONST_POINTER,
 };
 
-struct VariantBase {
-    virtual ~VariantBase() = default;
+static constexpr size_t VariantWrapperTypeCount = static_cast<size_t>(VariantWrapperType::CONST_POINTER) + 1;
+
+/// Values up to this size are kept inside the 'Variant' itself,
+/// as long as they are trivially copyable.
+static constexpr size_t VariantInlineSize = 3 * sizeof(void*);
+static constexpr size_t VariantInlineAlign = alignof(void*);
+
+template <typename T>
+concept IsInlineVariantValue = std::is_trivially_copyable_v<T>
+    && sizeof(T) <= VariantInlineSize
+    && alignof(T) <= VariantInlineAlign;
+
+/// Holds the data of a 'Variant' together with its wrapper type.
+/// References and pointers only store the address, small values are stored
+/// in place and everything else falls back to a shared heap allocation.
+struct VariantStorage {
+private:
+    using HeapT = std::shared_ptr<void>;
+    static_assert(sizeof(HeapT) <= VariantInlineSize);
+
+    enum class Mode : uint8_t {
+        Address = 0,
+        Inline,
+        Heap,
+    };
+
+    alignas(VariantInlineAlign) std::byte buffer_[VariantInlineSize];
+
+    // always points to the held object, or is the held pointer itself
+    void* data_ = nullptr;
+
+    VariantWrapperType type_ = VariantWrapperType::VOID;
+    Mode mode_ = Mode::Address;
+
+    VariantStorage() noexcept = default;
 
     [[nodiscard]]
-    virtual VariantWrapperType GetType() const = 0;
-};
+    HeapT& Heap() noexcept {
+        return *std::launder(reinterpret_cast<HeapT*>(buffer_));
+    }
+
+    [[nodiscard]]
+    const HeapT& Heap() const noexcept {
+        return *std::launder(reinterpret_cast<const HeapT*>(buffer_));
+    }
+
+    void CopyFrom(const VariantStorage& other) noexcept {
+        type_ = other.type_;
+        mode_ = other.mode_;
+        switch (mode_) {
+            case Mode::Address:
+                data_ = other.data_;
+                break;
+            case Mode::Inline:
+                // inline values are trivially copyable
+                std::memcpy(buffer_, other.buffer_, VariantInlineSize);
+                data_ = buffer_;
+                break;
+            case Mode::Heap:
+                new(buffer_) HeapT(other.Heap());
+                data_ = other.data_;
+                break;
+        }
+    }
+
+    void MoveFrom(VariantStorage&& other) noexcept {
+        if (other.mode_ == Mode::Heap) {
+            type_ = other.type_;
+            mode_ = other.mode_;
+            new(buffer_) HeapT(std::move(other.Heap()));
+            data_ = other.data_;
+            return;
+        }
+        CopyFrom(other);
+    }
+
+    void Destroy() noexcept {
+        if (mode_ == Mode::Heap) {
+            Heap().~HeapT();
+        }
+        mode_ = Mode::Address;
+        data_ = nullptr;
+    }
+
+public:
+    static VariantStorage CreateVoid() noexcept {
+        return {};
+    }
+
+    static VariantStorage CreateAddress(const VariantWrapperType type, const void* address) noexcept {
+        VariantStorage storage;
+        storage.type_ = type;
+        storage.data_ = const_cast<void*>(address);
+        return storage;
+    }
+
+    template <typename T, typename... Args>
+    static VariantStorage CreateValue(const VariantWrapperType type, Args&&... args) {
+        VariantStorage storage;
+        storage.type_ = type;
+        if constexpr (IsInlineVariantValue<T>) {
+            storage.data_ = new(storage.buffer_) T(std::forward<Args>(args)...);
+            storage.mode_ = Mode::Inline;
+        }
+        else {
+            auto heap = std::make_shared<T>(std::forward<Args>(args)...);
+            storage.data_ = heap.get();
+            new(storage.buffer_) HeapT(std::move(heap));
+            storage.mode_ = Mode::Heap;
+        }
+        return storage;
+    }
+
+    VariantStorage(const VariantStorage& other) noexcept {
+        CopyFrom(other);
+    }
+
+    VariantStorage(VariantStorage&& other) noexcept {
+        MoveFrom(std::move(other));
+    }
+
+    VariantStorage& operator=(const VariantStorage& other) noexcept {
+        if (this != &other) {
+            Destroy();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    VariantStorage& operator=(VariantStorage&& other) noexcept {
+        if (this != &other) {
+            Destroy();
+            MoveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    ~VariantStorage() noexcept {
+        Destroy();
+    }
+
+    [[nodiscard]]
+    VariantWrapperType GetType() const noexcept {
+        return type_;
+    }
+
+    [[nodiscard]]
+    void* GetData() const noexcept {
+        return data_;
+    }
 
-template <typename R>
-struct VariantWrapper : public VariantBase {
     [[nodiscard]]
-    virtual R GetValue() noexcept = 0;
+    bool IsInline() const noexcept {
+        return mode_ != Mode::Heap;
+    }
+
+    /// Whether the held value is on the heap and other copies hold it too.
+    [[nodiscard]]
+    bool IsShared() const noexcept {
+        return mode_ == Mode::Heap && Heap().use_count() > 1;
+    }
 };
 
 template <VariantWrapperType Type, typename R>
@@ -37,6 +192,30 @@ struct VariantMatcher {
         return false;
     }
 };
+
+template <typename T>
+struct VariantGetResultImpl {
+    using Type = std::remove_volatile_t<std::remove_reference_t<T>>&;
+};
+
+template <typename T>
+struct VariantGetResultImpl<T&&> {
+    using Type = std::remove_volatile_t<T>&&;
+};
+
+template <typename T>
+struct VariantGetResultImpl<T*> {
+    using Type = std::remove_volatile_t<T>*;
+};
+
+template <typename T>
+struct VariantGetResultImpl<T* const> {
+    using Type = std::remove_volatile_t<T>*;
+};
+
+/// What 'Variant::Get<T>' hands out on success.
+template <typename T>
+using VariantGetResult = typename VariantGetResultImpl<T>::Type;
 }
 
 namespace testing {
@@ -65,7 +244,7 @@ namespace ReflCpp {
 //TODO: decide if we want variant to be copy able
 struct Variant {
 private:
-    std::shared_ptr<detail::VariantBase> base_;
+    detail::VariantStorage storage_;
 
     TypeID type_;
 
@@ -77,8 +256,8 @@ private:
         return {};
     }
 
-    Variant(const std::shared_ptr<detail::VariantBase>& base, const TypeID type)
-        : base_(base), type_(type) {}
+    Variant(detail::VariantStorage&& storage, const TypeID type) noexcept
+        : storage_(std::move(storage)), type_(type) {}
 
     friend struct testing::VariantTestHelper;
 
@@ -103,9 +282,15 @@ public:
         requires (std::is_pointer_v<T>)
     static rescpp::result<Variant, ReflectError> Create(T data);
 
+    /// Copy of 'data' held like a temporary, as 'T&&',
+    /// so it only goes where a temporary could go.
+    template <typename T>
+        requires (!std::is_reference_v<T> && !std::is_pointer_v<T>)
+    static rescpp::result<Variant, ReflectError> CreateTemporary(const T& data);
+
     [[nodiscard]]
     bool IsVoid() const {
-        return base_->GetType() == detail::VariantWrapperType::VOID;
+        return storage_.GetType() == detail::VariantWrapperType::VOID;
     }
 
     [[nodiscard]]
@@ -113,17 +298,40 @@ public:
         return type_;
     }
 
+    /// How the value is held, which together with 'GetType' decides what it can be gotten as.
+    [[nodiscard]]
+    detail::VariantWrapperType GetWrapperType() const noexcept {
+        return storage_.GetType();
+    }
+
+    /// Address of the held object, or the held pointer itself for pointers.
+    [[nodiscard]]
+    const void* GetAddress() const noexcept {
+        return storage_.GetData();
+    }
+
+    /// Whether copies of this variant hold the same value, so writing to it changes them too.
+    [[nodiscard]]
+    bool IsShared() const noexcept {
+        return storage_.IsShared();
+    }
+
+    template <typename T>
+    [[nodiscard]]
+    bool CanGet() const noexcept;
+
+    /// Whether a variant of 'type' held as 'wrapper' could be gotten as 'T'.
     template <typename T>
     [[nodiscard]]
-    bool CanGet() const;
+    static bool CanGet(TypeID type, detail::VariantWrapperType wrapper) noexcept;
 
     template <typename T>
     [[nodiscard]]
-    rescpp::result<void, VariantGetError> CheckGet() const;
+    rescpp::result<void, VariantGetError> CheckGet() const noexcept;
 
 private:
     template <typename ReturnT, typename T>
-    rescpp::result<ReturnT, VariantGetError> Variant::GetImpl() const;
+    rescpp::result<ReturnT, VariantGetError> GetImpl() const;
 
 public:
     template <typename T>
@@ -141,6 +349,12 @@ public:
 
     template <typename T>
         requires (std::is_pointer_v<T>)
-    rescpp::result<std::remove_volatile_t<std::remove_pointer_t<T>>*, VariantGetError> Get() const;
+    rescpp::result<std::remove_volatile_t<std::remove_pointer_t<T>>*, VariantGetError> Get() const noexcept;
+
+    /// Same as 'Get', but without checking.
+    /// Expects 'CanGet<T>()' to be true, which the caller has to have made sure of.
+    template <typename T>
+    [[nodiscard]]
+    detail::VariantGetResult<T> GetUnchecked() const noexcept;
 };
 }
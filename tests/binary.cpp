@@ -0,0 +1,345 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/binary.hpp>
+
+namespace ReflCpp::testing {
+struct Vec3 {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+// padding between 'kind' and 'id'
+struct Header {
+    uint8_t kind = 0;
+    uint32_t id = 0;
+};
+
+struct Record {
+    Header header;
+    Vec3 position;
+    std::string name;
+    const int version = 1;
+    static int count;
+};
+
+int Record::count = 0;
+
+// private members, so no offsets are known
+class Account {
+    std::string owner_;
+
+public:
+    double balance = 0.0;
+
+    Account() = default;
+
+    explicit Account(std::string owner, const double balance)
+        : owner_(std::move(owner)), balance(balance) {}
+
+    [[nodiscard]]
+    const std::string& GetOwner() const {
+        return owner_;
+    }
+
+    static constexpr auto OwnerPtr = &Account::owner_;
+};
+
+struct Linked {
+    int value = 0;
+    Linked* next = nullptr;
+};
+
+// every byte is still a field of the base or its own
+struct TaggedVec3 : Vec3 {
+    uint32_t tag = 0;
+};
+
+struct NamedHeader : Header {
+    std::string name;
+};
+
+// bases without an offset
+struct UnplacedHeader : Header {
+    int value = 0;
+};
+
+// bases reflected without fields, which are written like a field of their type
+struct OpaqueBits {
+    uint32_t bits = 0;
+};
+
+struct OpaqueBitsDerived : OpaqueBits {
+    int32_t x = 0;
+};
+
+struct OpaqueName {
+    std::string name;
+};
+
+struct OpaqueNameDerived : OpaqueName {
+    int32_t x = 0;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::Vec3){
+    .name = "Vec3",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::Vec3::x, .name = "x" },
+        FieldData{ .ptr = &ReflCpp::testing::Vec3::y, .name = "y" },
+        FieldData{ .ptr = &ReflCpp::testing::Vec3::z, .name = "z" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::Header){
+    .name = "Header",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::Header::kind, .name = "kind" },
+        FieldData{ .ptr = &ReflCpp::testing::Header::id, .name = "id" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::Record){
+    .name = "Record",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::Record::header, .name = "header" },
+        FieldData{ .ptr = &ReflCpp::testing::Record::position, .name = "position" },
+        FieldData{ .ptr = &ReflCpp::testing::Record::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::Record::version, .name = "version" },
+        FieldData{ .ptr = &ReflCpp::testing::Record::count, .name = "count" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::Account){
+    .name = "Account",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = ReflCpp::testing::Account::OwnerPtr, .name = "owner" },
+        FieldData{ .ptr = &ReflCpp::testing::Account::balance, .name = "balance" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::Linked){
+    .name = "Linked",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::Linked::value, .name = "value" },
+        FieldData{ .ptr = &ReflCpp::testing::Linked::next, .name = "next" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::TaggedVec3){
+    .name = "TaggedVec3",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::Vec3>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::TaggedVec3, ReflCpp::testing::Vec3>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::TaggedVec3::tag, .name = "tag" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::NamedHeader){
+    .name = "NamedHeader",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::Header>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::NamedHeader, ReflCpp::testing::Header>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::NamedHeader::name, .name = "name" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::UnplacedHeader){
+    .name = "UnplacedHeader",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::Header>().value() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::UnplacedHeader::value, .name = "value" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::OpaqueBits){
+    .name = "OpaqueBits",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::OpaqueBitsDerived){
+    .name = "OpaqueBitsDerived",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::OpaqueBits>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::OpaqueBitsDerived, ReflCpp::testing::OpaqueBits>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::OpaqueBitsDerived::x, .name = "x" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::OpaqueName){
+    .name = "OpaqueName",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::OpaqueNameDerived){
+    .name = "OpaqueNameDerived",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::OpaqueName>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::OpaqueNameDerived, ReflCpp::testing::OpaqueName>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::OpaqueNameDerived::x, .name = "x" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+#define TRY_FAIL(...) \
+    RESCPP_TRY_IMPL((__VA_ARGS__), { \
+        FAIL("result was bad\n" << std::stacktrace::current(1)); \
+    })
+
+namespace ReflCpp::testing {
+TEST_CASE("Binary Serializer Tests", "[binary]") {
+    SECTION("Plans") {
+        auto& cache = detail::BinaryPlanCache::Instance();
+
+        // every byte is a field, so it is copied as a whole
+        const BinaryPlan& vec = TRY_FAIL(cache.Get(TRY_FAIL(Reflect<Vec3>())));
+        REQUIRE(vec.kind == BinaryPlan::Kind::Bytes);
+        REQUIRE(vec.size == sizeof(Vec3));
+        REQUIRE(&vec == &TRY_FAIL(cache.Get(TRY_FAIL(Reflect<Vec3>()))));
+
+        const BinaryPlan& header = TRY_FAIL(cache.Get(TRY_FAIL(Reflect<Header>())));
+        REQUIRE(header.kind == BinaryPlan::Kind::Fields);
+
+        const BinaryPlan& record = TRY_FAIL(cache.Get(TRY_FAIL(Reflect<Record>())));
+        REQUIRE(record.kind == BinaryPlan::Kind::Fields);
+        REQUIRE(record.fields.size() == 4);
+        REQUIRE(record.fields[1].plan == &vec);
+        REQUIRE(record.fields[2].plan->kind == BinaryPlan::Kind::String);
+    }
+
+    SECTION("Round trip") {
+        Record record;
+        record.header = { 3, 0xDEADBEEF };
+        record.position = { 1.0f, 2.0f, 3.0f };
+        record.name = "first record";
+
+        const std::vector<std::byte> bytes = TRY_FAIL(SerializeBinary(record));
+        // prefix, 1 + 4 header, 12 position, 8 + 12 name, 4 version
+        REQUIRE(bytes.size() == 8 + 5 + 12 + 20 + 4);
+
+        Record read;
+        REQUIRE(TRY_FAIL(DeserializeBinary(std::span(bytes), read)) == bytes.size());
+        REQUIRE(read.header.kind == 3);
+        REQUIRE(read.header.id == 0xDEADBEEF);
+        REQUIRE(read.position.y == 2.0f);
+        REQUIRE(read.name == "first record");
+    }
+
+    SECTION("Bases") {
+        auto& cache = detail::BinaryPlanCache::Instance();
+        const BinaryPlan& tagged = TRY_FAIL(cache.Get(TRY_FAIL(Reflect<TaggedVec3>())));
+        REQUIRE(tagged.kind == BinaryPlan::Kind::Bytes);
+
+        TaggedVec3 vec;
+        vec.y = 2.0f;
+        vec.tag = 7;
+        const std::vector<std::byte> vec_bytes = TRY_FAIL(SerializeBinary(vec));
+        TaggedVec3 read_vec;
+        REQUIRE(TRY_FAIL(DeserializeBinary(std::span(vec_bytes), read_vec)) == 8 + 16);
+        REQUIRE(read_vec.y == 2.0f);
+        REQUIRE(read_vec.tag == 7);
+
+        // the base comes before the own fields
+        NamedHeader header;
+        header.kind = 4;
+        header.id = 42;
+        header.name = "header";
+        const std::vector<std::byte> bytes = TRY_FAIL(SerializeBinary(header));
+        REQUIRE(bytes.size() == 8 + 5 + 8 + 6);
+        REQUIRE(bytes[8] == std::byte(4));
+
+        NamedHeader read;
+        REQUIRE(TRY_FAIL(DeserializeBinary(std::span(bytes), read)) == bytes.size());
+        REQUIRE(read.kind == 4);
+        REQUIRE(read.id == 42);
+        REQUIRE(read.name == "header");
+
+        // a base without reflected fields is written as its bytes
+        const OpaqueBitsDerived opaque{ { 0xABCD }, 5 };
+        const std::vector<std::byte> opaque_bytes = TRY_FAIL(SerializeBinary(opaque));
+        REQUIRE(opaque_bytes.size() == 8 + 8);
+        OpaqueBitsDerived read_opaque;
+        REQUIRE(TRY_FAIL(DeserializeBinary(std::span(opaque_bytes), read_opaque)) == opaque_bytes.size());
+        REQUIRE(read_opaque.bits == 0xABCD);
+        REQUIRE(read_opaque.x == 5);
+    }
+
+    SECTION("Objects one after another") {
+        std::vector<std::byte> bytes;
+        TRY_FAIL(SerializeBinary(Vec3{ 1.0f, 2.0f, 3.0f }, bytes));
+        TRY_FAIL(SerializeBinary(Account("someone", 12.5), bytes));
+        REQUIRE(bytes.size() == 8 + 12 + 8 + 8 + 7 + 8);
+
+        std::span<const std::byte> in = bytes;
+        Vec3 vec;
+        in = in.subspan(TRY_FAIL(DeserializeBinary(in, vec)));
+        REQUIRE(vec.z == 3.0f);
+
+        Account account;
+        in = in.subspan(TRY_FAIL(DeserializeBinary(in, account)));
+        REQUIRE(account.GetOwner() == "someone");
+        REQUIRE(account.balance == 12.5);
+        REQUIRE(in.empty());
+    }
+
+    SECTION("Broken input") {
+        Record record;
+        record.name = "name";
+        std::vector<std::byte> bytes = TRY_FAIL(SerializeBinary(record));
+
+        Record read;
+        REQUIRE(DeserializeBinary(std::span(bytes).first(bytes.size() - 1), read).error() == BinaryError::Truncated);
+        REQUIRE(DeserializeBinary(std::span(bytes).first(4), read).error() == BinaryError::Truncated);
+
+        // a longer prefix than the object takes
+        bytes.push_back(std::byte(0));
+        bytes[0] = std::byte(static_cast<uint8_t>(bytes[0]) + 1);
+        REQUIRE(DeserializeBinary(std::span(bytes), read).error() == BinaryError::LengthMismatch);
+    }
+
+    SECTION("Unsupported") {
+        REQUIRE(SerializeBinary(Linked{}).error() == BinaryError::Unsupported);
+        REQUIRE(SerializeBinary(UnplacedHeader{}).error() == BinaryError::Unsupported);
+        // a base without reflected fields that can not be copied as bytes
+        REQUIRE(SerializeBinary(OpaqueNameDerived{}).error() == BinaryError::Unsupported);
+    }
+}
+}
@@ -0,0 +1,304 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/compare.hpp>
+
+namespace ReflCpp::testing {
+struct CompareBytes {
+    uint8_t major = 0;
+    uint8_t minor = 0;
+    uint8_t patch = 0;
+};
+
+struct ComparePacked {
+    int32_t a = 0;
+    uint32_t b = 0;
+};
+
+struct ComparePadded {
+    uint8_t small = 0;
+    int64_t big = 0;
+};
+
+struct CompareMixed {
+    std::string name;
+    double weight = 0.0;
+    ComparePadded padded;
+    static int count;
+};
+
+int CompareMixed::count = 0;
+
+// the bytes of -1 are larger than the ones of 300
+enum class CompareColor : int {
+    Red = -1,
+    Green = 300,
+};
+
+// reflected without fields, so its bytes have no known order
+struct CompareOpaque {
+    uint32_t bits = 0;
+};
+
+struct CompareDerived : ComparePacked {
+    CompareColor color = CompareColor::Red;
+};
+
+struct CompareDerivedBytes : CompareBytes {
+    uint8_t build = 0;
+};
+
+// a base without reflected fields still holds data
+struct CompareOpaqueDerived : CompareOpaque {
+    int32_t x = 0;
+};
+
+struct CompareTag {};
+
+struct CompareTagged : CompareTag {
+    int32_t x = 0;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareBytes){
+    .name = "CompareBytes",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::CompareBytes::major, .name = "major" },
+        FieldData{ .ptr = &ReflCpp::testing::CompareBytes::minor, .name = "minor" },
+        FieldData{ .ptr = &ReflCpp::testing::CompareBytes::patch, .name = "patch" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::ComparePacked){
+    .name = "ComparePacked",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::ComparePacked::a, .name = "a" },
+        FieldData{ .ptr = &ReflCpp::testing::ComparePacked::b, .name = "b" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::ComparePadded){
+    .name = "ComparePadded",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::ComparePadded::small, .name = "small" },
+        FieldData{ .ptr = &ReflCpp::testing::ComparePadded::big, .name = "big" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareMixed){
+    .name = "CompareMixed",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::CompareMixed::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::CompareMixed::weight, .name = "weight" },
+        FieldData{ .ptr = &ReflCpp::testing::CompareMixed::padded, .name = "padded" },
+        FieldData{ .ptr = &ReflCpp::testing::CompareMixed::count, .name = "count" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareColor){
+    .name = "CompareColor",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareOpaque){
+    .name = "CompareOpaque",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareDerived){
+    .name = "CompareDerived",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::ComparePacked>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::CompareDerived, ReflCpp::testing::ComparePacked>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::CompareDerived::color, .name = "color" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareDerivedBytes){
+    .name = "CompareDerivedBytes",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::CompareBytes>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::CompareDerivedBytes, ReflCpp::testing::CompareBytes>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::CompareDerivedBytes::build, .name = "build" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareOpaqueDerived){
+    .name = "CompareOpaqueDerived",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::CompareOpaque>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::CompareOpaqueDerived, ReflCpp::testing::CompareOpaque>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::CompareOpaqueDerived::x, .name = "x" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareTag){
+    .name = "CompareTag",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::CompareTagged){
+    .name = "CompareTagged",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::CompareTag>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::CompareTagged, ReflCpp::testing::CompareTag>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::CompareTagged::x, .name = "x" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+#define TRY_FAIL(...) \
+    RESCPP_TRY_IMPL((__VA_ARGS__), { \
+        FAIL("result was bad\n" << std::stacktrace::current(1)); \
+    })
+
+namespace ReflCpp::testing {
+template <typename T>
+static const ComparePlan& GetPlan() {
+    return detail::ComparePlanCache::Instance().Get(Reflect<T>().value()).value();
+}
+
+TEST_CASE("Compare Tests", "[compare]") {
+    SECTION("Plans") {
+        REQUIRE(GetPlan<CompareBytes>().bitwiseEqual);
+        REQUIRE(GetPlan<CompareBytes>().bitwiseOrdered);
+
+        // equal by bytes, but the order of signed and multi byte integers is not the one of their bytes
+        REQUIRE(GetPlan<ComparePacked>().bitwiseEqual);
+        REQUIRE_FALSE(GetPlan<ComparePacked>().bitwiseOrdered);
+
+        REQUIRE_FALSE(GetPlan<ComparePadded>().bitwiseEqual);
+        REQUIRE_FALSE(GetPlan<CompareMixed>().bitwiseEqual);
+
+        REQUIRE(GetPlan<CompareColor>().kind == ComparePlan::Kind::Value);
+        REQUIRE(GetPlan<CompareColor>().bitwiseEqual);
+        REQUIRE_FALSE(GetPlan<CompareColor>().bitwiseOrdered);
+
+        REQUIRE(GetPlan<CompareOpaque>().bitwiseEqual);
+        REQUIRE_FALSE(GetPlan<CompareOpaque>().bitwiseOrdered);
+        REQUIRE_FALSE(GetPlan<CompareOpaque>().ordered);
+
+        REQUIRE(GetPlan<CompareDerived>().bitwiseEqual);
+        REQUIRE_FALSE(GetPlan<CompareDerived>().bitwiseOrdered);
+        // fields in both the base and the type are not standard layout, so the offset of 'build' is unknown
+        REQUIRE_FALSE(GetPlan<CompareDerivedBytes>().bitwiseOrdered);
+    }
+
+    SECTION("Equals") {
+        REQUIRE(TRY_FAIL(Equals(ComparePacked{ 1, 2 }, ComparePacked{ 1, 2 })));
+        REQUIRE_FALSE(TRY_FAIL(Equals(ComparePacked{ 1, 2 }, ComparePacked{ 1, 3 })));
+
+        // padding bytes are not part of the value
+        alignas(ComparePadded) std::byte first[sizeof(ComparePadded)];
+        alignas(ComparePadded) std::byte second[sizeof(ComparePadded)];
+        std::memset(first, 0x00, sizeof(first));
+        std::memset(second, 0xCD, sizeof(second));
+        const auto* a = new (first) ComparePadded{ 1, 2 };
+        const auto* b = new (second) ComparePadded{ 1, 2 };
+        REQUIRE(TRY_FAIL(Equals(*a, *b)));
+
+        CompareMixed left{ "left", 0.0, { 3, 4 } };
+        CompareMixed right{ "left", -0.0, { 3, 4 } };
+        REQUIRE(TRY_FAIL(Equals(left, right)));
+        right.name = "right";
+        REQUIRE_FALSE(TRY_FAIL(Equals(left, right)));
+
+        right.name = "left";
+        right.weight = std::numeric_limits<double>::quiet_NaN();
+        left.weight = right.weight;
+        REQUIRE_FALSE(TRY_FAIL(Equals(left, right)));
+    }
+
+    SECTION("Compare") {
+        REQUIRE(TRY_FAIL(Compare(CompareBytes{ 1, 2, 3 }, CompareBytes{ 1, 3, 0 })) == std::partial_ordering::less);
+        REQUIRE(TRY_FAIL(Compare(CompareBytes{ 2, 0, 0 }, CompareBytes{ 1, 9, 9 })) == std::partial_ordering::greater);
+        REQUIRE(TRY_FAIL(Compare(CompareBytes{ 1, 2, 3 }, CompareBytes{ 1, 2, 3 })) == std::partial_ordering::equivalent);
+
+        REQUIRE(TRY_FAIL(Compare(ComparePacked{ -1, 0 }, ComparePacked{ 1, 0 })) == std::partial_ordering::less);
+        REQUIRE(TRY_FAIL(Compare(ComparePacked{ 1, 256 }, ComparePacked{ 1, 1 })) == std::partial_ordering::greater);
+
+        const CompareMixed first{ "a", 2.0, { 1, 1 } };
+        const CompareMixed second{ "a", 2.0, { 1, 2 } };
+        const CompareMixed third{ "b", 0.0, { 0, 0 } };
+        REQUIRE(TRY_FAIL(Compare(first, second)) == std::partial_ordering::less);
+        REQUIRE(TRY_FAIL(Compare(third, second)) == std::partial_ordering::greater);
+
+        const CompareMixed nan{ "a", std::numeric_limits<double>::quiet_NaN(), { 1, 1 } };
+        REQUIRE(TRY_FAIL(Compare(first, nan)) == std::partial_ordering::unordered);
+    }
+
+    SECTION("Enums") {
+        REQUIRE(TRY_FAIL(Compare(CompareColor::Red, CompareColor::Green)) == std::partial_ordering::less);
+        REQUIRE(TRY_FAIL(Compare(CompareColor::Green, CompareColor::Red)) == std::partial_ordering::greater);
+        REQUIRE(TRY_FAIL(Equals(CompareColor::Green, CompareColor::Green)));
+    }
+
+    SECTION("Bases") {
+        // the base decides before the own fields
+        const CompareDerived first{ { 1, 2 }, CompareColor::Green };
+        const CompareDerived second{ { 1, 3 }, CompareColor::Red };
+        REQUIRE(TRY_FAIL(Compare(first, second)) == std::partial_ordering::less);
+        REQUIRE_FALSE(TRY_FAIL(Equals(first, second)));
+
+        CompareDerived third = first;
+        REQUIRE(TRY_FAIL(Equals(first, third)));
+        third.b = 1;
+        REQUIRE_FALSE(TRY_FAIL(Equals(first, third)));
+        REQUIRE(TRY_FAIL(Compare(first, third)) == std::partial_ordering::greater);
+
+        const CompareDerivedBytes older{ { 1, 2, 3 }, 9 };
+        const CompareDerivedBytes newer{ { 1, 3, 0 }, 0 };
+        REQUIRE(TRY_FAIL(Compare(older, newer)) == std::partial_ordering::less);
+    }
+
+    SECTION("Unordered bytes") {
+        REQUIRE(TRY_FAIL(Equals(CompareOpaque{ 1 }, CompareOpaque{ 1 })));
+        REQUIRE_FALSE(TRY_FAIL(Equals(CompareOpaque{ 1 }, CompareOpaque{ 2 })));
+        REQUIRE(Compare(CompareOpaque{ 1 }, CompareOpaque{ 2 }).error() == CompareError::Unsupported);
+
+        // the same holds for them as a base, only empty bases are left out
+        const CompareOpaqueDerived first{ { 1 }, 5 };
+        const CompareOpaqueDerived second{ { 2 }, 5 };
+        REQUIRE(TRY_FAIL(Equals(first, first)));
+        REQUIRE_FALSE(TRY_FAIL(Equals(first, second)));
+        REQUIRE(Compare(first, second).error() == CompareError::Unsupported);
+
+        REQUIRE(TRY_FAIL(Compare(CompareTagged{ {}, 1 }, CompareTagged{ {}, 2 })) == std::partial_ordering::less);
+    }
+}
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+
+namespace ReflCpp::testing {
+template <size_t N>
+struct DatabaseTestStruct {};
+}
+
+REFLCPP_REFLECT_TEMPLATE(size_t N)
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::testing::DatabaseTestStruct<N>)
+REFLCPP_REFLECT_TEMPLATE(size_t N)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::testing::DatabaseTestStruct<N>)
+{ .name = "DatabaseTestStruct" }
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace {
+// named like the one in 'type_id.cpp', to make their stable ids collide
+struct CollidingStruct {};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(CollidingStruct)
+REFLCPP_REFLECT_DATA_DEF(CollidingStruct)
+{ .name = "CollidingStruct" }
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::testing {
+rescpp::result<TypeID, ReflectError> ReflectOtherCollidingStruct() noexcept {
+    return ReflectID<CollidingStruct>();
+}
+
+static constexpr size_t DatabaseTestTypeCount = 128;
+
+template <size_t... N>
+static std::vector<TypeID> RegisterDatabaseTestTypes(std::index_sequence<N...>) {
+    // pointers get registered too, which makes registration recurse
+    return { ReflectID<DatabaseTestStruct<N>*>().value()... };
+}
+
+template <size_t... N>
+static bool AreDatabaseTestTypes(const std::vector<TypeID>& ids, std::index_sequence<N...>) {
+    const auto& database = ReflectionDatabase::Instance();
+    return (database.GetType(ids[N]).value().template Is<DatabaseTestStruct<N>*>() && ...);
+}
+
+TEST_CASE("ReflectionDatabase Tests", "[database]") {
+    SECTION("ChunkedTable") {
+        detail::ChunkedTable<const int> table;
+        std::vector<int> values(1000);
+
+        CHECK(table.Get(0) == nullptr);
+        for (size_t i = 0; i < values.size(); ++i) {
+            REQUIRE(table.Append(&values[i]) == i);
+        }
+
+        CHECK(table.Size() == values.size());
+        CHECK(table.Get(values.size()) == nullptr);
+        // reserving does not publish anything
+        REQUIRE(table.Reserve());
+        CHECK(table.Size() == values.size());
+        CHECK(table.Get(values.size()) == nullptr);
+        for (size_t i = 0; i < values.size(); ++i) {
+            REQUIRE(table.Get(i) == &values[i]);
+        }
+    }
+
+    SECTION("ConcurrentIDMap") {
+        detail::ConcurrentIDMap<const int> map;
+        std::vector<int> values(1000);
+
+        CHECK(map.Find(1) == nullptr);
+        REQUIRE(map.Reserve());
+        CHECK(map.Find(StableTypeID<int>().Value()) == nullptr);
+        for (size_t i = 0; i < values.size(); ++i) {
+            REQUIRE(map.Insert(StableTypeID<int>().Value() + i, &values[i]));
+        }
+
+        CHECK(map.Find(0) == nullptr);
+        for (size_t i = 0; i < values.size(); ++i) {
+            REQUIRE(map.Find(StableTypeID<int>().Value() + i) == &values[i]);
+        }
+    }
+
+    SECTION("Arena") {
+        struct Counted {
+            int& destroyed;
+
+            ~Counted() {
+                ++destroyed;
+            }
+        };
+
+        int destroyed = 0;
+        {
+            detail::Arena arena(64);
+            const auto* first = arena.Create<uint8_t>(uint8_t(1));
+            const auto* second = arena.Create<uint64_t>(uint64_t(2));
+            CHECK(reinterpret_cast<uintptr_t>(second) % alignof(uint64_t) == 0);
+            // allocated one after another in the same block
+            CHECK(reinterpret_cast<const std::byte*>(second) - reinterpret_cast<const std::byte*>(first) < 16);
+
+            const std::vector<int> values{ 1, 2, 3 };
+            const std::span<int> range = arena.CreateRange(std::span<const int>(values));
+            CHECK(std::vector(range.begin(), range.end()) == values);
+
+            // bigger than a block
+            CHECK(arena.Allocate(1000, 8) != nullptr);
+            for (size_t i = 0; i < 10; ++i) {
+                (void)arena.Create<Counted>(destroyed);
+            }
+            CHECK(destroyed == 0);
+
+            const auto stats = arena.GetStats();
+            CHECK(stats.used >= 1000 + 10 * sizeof(Counted));
+            CHECK(stats.reserved >= stats.used);
+            CHECK(stats.blocks >= 2);
+        }
+        CHECK(destroyed == 10);
+    }
+
+    SECTION("Concurrent Registration") {
+        constexpr auto sequence = std::make_index_sequence<DatabaseTestTypeCount>();
+        const size_t thread_count = std::max(4u, std::thread::hardware_concurrency());
+
+        std::vector<std::vector<TypeID>> results(thread_count);
+        {
+            std::vector<std::jthread> threads;
+            for (size_t i = 0; i < thread_count; ++i) {
+                threads.emplace_back([&results, i, sequence] {
+                    results[i] = RegisterDatabaseTestTypes(sequence);
+                });
+            }
+        }
+
+        // every thread has to see the same id for the same type
+        for (const auto& ids : results) {
+            CHECK(ids == results.front());
+        }
+        CHECK(AreDatabaseTestTypes(results.front(), sequence));
+    }
+}
+}
@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/flat.hpp>
+
+namespace ReflCpp::testing {
+struct FlatVec {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct alignas(16) FlatBody {
+    uint64_t id = 0;
+    FlatVec position;
+    uint8_t kind = 0;
+};
+
+// same fields in a different order, so the same members at other offsets
+struct FlatBodyReordered {
+    uint8_t kind = 0;
+    uint64_t id = 0;
+    FlatVec position;
+};
+
+struct FlatNamed {
+    std::string name;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::FlatVec){
+    .name = "FlatVec",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::FlatVec::x, .name = "x" },
+        FieldData{ .ptr = &ReflCpp::testing::FlatVec::y, .name = "y" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::FlatBody){
+    .name = "FlatBody",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::FlatBody::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::testing::FlatBody::position, .name = "position" },
+        FieldData{ .ptr = &ReflCpp::testing::FlatBody::kind, .name = "kind" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::FlatBodyReordered){
+    .name = "FlatBody",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::FlatBodyReordered::kind, .name = "kind" },
+        FieldData{ .ptr = &ReflCpp::testing::FlatBodyReordered::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::testing::FlatBodyReordered::position, .name = "position" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::FlatNamed){
+    .name = "FlatNamed",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::FlatNamed::name, .name = "name" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+#define TRY_FAIL(...) \
+    RESCPP_TRY_IMPL((__VA_ARGS__), { \
+        FAIL("result was bad\n" << std::stacktrace::current(1)); \
+    })
+
+namespace ReflCpp::testing {
+static std::vector<FlatBody> MakeBodies(const size_t count) {
+    std::vector<FlatBody> bodies(count);
+    for (size_t i = 0; i < count; ++i) {
+        bodies[i].id = i * 3;
+        bodies[i].position = { static_cast<float>(i), -static_cast<float>(i) };
+        bodies[i].kind = static_cast<uint8_t>(i % 5);
+    }
+    return bodies;
+}
+
+TEST_CASE("Flat Format Tests", "[flat]") {
+    const std::vector<FlatBody> bodies = MakeBodies(1000);
+
+    SECTION("Mapped file") {
+        const auto path = std::filesystem::temp_directory_path() / "refl-cpp_flat_test.bin";
+        {
+            std::ofstream out(path, std::ios::binary);
+            TRY_FAIL(WriteFlat(std::span(bodies), out));
+        }
+        REQUIRE(std::filesystem::file_size(path) == sizeof(FlatHeader) + bodies.size() * sizeof(FlatBody));
+
+        {
+            const auto file = TRY_FAIL(FlatFile<FlatBody>::Open(path.string().c_str()));
+            const std::span<const FlatBody> read = file.Objects();
+            REQUIRE(read.size() == bodies.size());
+            REQUIRE(read[999].id == 2997);
+            REQUIRE(read[10].position.y == -10.0f);
+            REQUIRE(read[7].kind == 2);
+        }
+        std::filesystem::remove(path);
+
+        REQUIRE(FlatFile<FlatBody>::Open(path.string().c_str()).error() == FlatError::OpenFailed);
+    }
+
+    SECTION("In place") {
+        std::ostringstream out;
+        TRY_FAIL(WriteFlat(std::span(bodies).first(3), out));
+        const std::string written = out.str();
+
+        // copied into aligned memory, like a mapping would be
+        std::vector<FlatBody> storage(written.size() / sizeof(FlatBody) + 1);
+        std::memcpy(storage.data(), written.data(), written.size());
+        const std::span bytes(reinterpret_cast<const std::byte*>(storage.data()), written.size());
+
+        const std::span<const FlatBody> read = TRY_FAIL(OpenFlat<FlatBody>(bytes));
+        REQUIRE(read.size() == 3);
+        REQUIRE(reinterpret_cast<const void*>(read.data()) == storage.data() + 2);
+        REQUIRE(read[2].id == 6);
+    }
+
+    SECTION("Validation") {
+        std::ostringstream out;
+        TRY_FAIL(WriteFlat(std::span(bodies).first(2), out));
+        const std::string written = out.str();
+
+        std::vector<FlatBody> storage(written.size() / sizeof(FlatBody) + 1);
+        const auto load = [&](const std::string& data) {
+            std::memcpy(storage.data(), data.data(), data.size());
+            return std::span(reinterpret_cast<const std::byte*>(storage.data()), data.size());
+        };
+
+        REQUIRE(OpenFlat<FlatBodyReordered>(load(written)).error() == FlatError::FingerprintMismatch);
+        REQUIRE(OpenFlat<FlatBody>(load(written.substr(0, 32))).error() == FlatError::TooSmall);
+        REQUIRE(OpenFlat<FlatBody>(load(written.substr(0, written.size() - 1))).error() == FlatError::SizeMismatch);
+
+        std::string broken = written;
+        broken[0] = 'X';
+        REQUIRE(OpenFlat<FlatBody>(load(broken)).error() == FlatError::BadMagic);
+
+        broken = written;
+        broken[8] = 2;
+        REQUIRE(OpenFlat<FlatBody>(load(broken)).error() == FlatError::VersionMismatch);
+
+        broken = written;
+        std::swap(broken[12], broken[15]);
+        REQUIRE(OpenFlat<FlatBody>(load(broken)).error() == FlatError::ByteOrderMismatch);
+
+        // the header is fine, but the objects do not start on their alignment
+        storage.resize(storage.size() + 1);
+        auto* shifted = reinterpret_cast<std::byte*>(storage.data()) + 8;
+        std::memcpy(shifted, written.data(), written.size());
+        REQUIRE(OpenFlat<FlatBody>(std::span<const std::byte>(shifted, written.size())).error() == FlatError::Misaligned);
+    }
+
+    SECTION("Unsupported") {
+        std::ostringstream out;
+        const std::vector<FlatNamed> named(1);
+        REQUIRE(WriteFlat(std::span(named), out).error() == FlatError::Unsupported);
+    }
+}
+}
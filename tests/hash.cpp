@@ -0,0 +1,269 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/compare.hpp>
+#include <refl-cpp/hash.hpp>
+
+namespace ReflCpp::testing {
+struct HashPacked {
+    uint32_t a = 0;
+    uint32_t b = 0;
+    uint64_t c = 0;
+};
+
+struct HashPadded {
+    uint8_t small = 0;
+    uint64_t big = 0;
+};
+
+struct HashNamed {
+    int32_t id = 0;
+    std::string name;
+    HashPadded padded;
+    static int count;
+};
+
+int HashNamed::count = 0;
+
+// nothing reflected and not trivially copyable, so there is nothing to hash it by
+struct HashUnsupported {
+    std::string name;
+};
+
+// covers every byte, but floating point values can not be hashed by their bytes
+struct HashFloats {
+    float x = 0.0f;
+    float y = 0.0f;
+    double z = 0.0;
+};
+
+struct HashDerived : HashPacked {
+    uint64_t d = 0;
+};
+
+// reflected without fields, but holds data
+struct HashOpaque {
+    uint32_t bits = 0;
+};
+
+struct HashOpaqueDerived : HashOpaque {
+    int32_t x = 0;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashPacked){
+    .name = "HashPacked",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::HashPacked::a, .name = "a" },
+        FieldData{ .ptr = &ReflCpp::testing::HashPacked::b, .name = "b" },
+        FieldData{ .ptr = &ReflCpp::testing::HashPacked::c, .name = "c" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashPadded){
+    .name = "HashPadded",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::HashPadded::small, .name = "small" },
+        FieldData{ .ptr = &ReflCpp::testing::HashPadded::big, .name = "big" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashNamed){
+    .name = "HashNamed",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::HashNamed::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::testing::HashNamed::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::HashNamed::padded, .name = "padded" },
+        FieldData{ .ptr = &ReflCpp::testing::HashNamed::count, .name = "count" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashUnsupported){
+    .name = "HashUnsupported",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashFloats){
+    .name = "HashFloats",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::HashFloats::x, .name = "x" },
+        FieldData{ .ptr = &ReflCpp::testing::HashFloats::y, .name = "y" },
+        FieldData{ .ptr = &ReflCpp::testing::HashFloats::z, .name = "z" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashDerived){
+    .name = "HashDerived",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::HashPacked>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::HashDerived, ReflCpp::testing::HashPacked>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::HashDerived::d, .name = "d" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashOpaque){
+    .name = "HashOpaque",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::HashOpaqueDerived){
+    .name = "HashOpaqueDerived",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::HashOpaque>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::HashOpaqueDerived, ReflCpp::testing::HashOpaque>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::HashOpaqueDerived::x, .name = "x" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+#define TRY_FAIL(...) \
+    RESCPP_TRY_IMPL((__VA_ARGS__), { \
+        FAIL("result was bad\n" << std::stacktrace::current(1)); \
+    })
+
+namespace ReflCpp::testing {
+TEST_CASE("Hash Tests", "[hash]") {
+    SECTION("Packed") {
+        const HashPacked packed{ 1, 2, 3 };
+        REQUIRE(TRY_FAIL(detail::HashPlanCache::Instance().Get(TRY_FAIL(Reflect<HashPacked>()))).kind == HashPlan::Kind::Bytes);
+        REQUIRE(TRY_FAIL(Hash(packed)) == detail::HashBytes(&packed, sizeof(packed)));
+
+        const HashPacked swapped{ 2, 1, 3 };
+        REQUIRE(TRY_FAIL(Hash(packed)) != TRY_FAIL(Hash(swapped)));
+    }
+
+    SECTION("Padding") {
+        REQUIRE(TRY_FAIL(detail::HashPlanCache::Instance().Get(TRY_FAIL(Reflect<HashPadded>()))).kind == HashPlan::Kind::Fields);
+
+        // the same values with different bytes in between
+        alignas(HashPadded) std::byte first[sizeof(HashPadded)];
+        alignas(HashPadded) std::byte second[sizeof(HashPadded)];
+        std::memset(first, 0x00, sizeof(first));
+        std::memset(second, 0xAB, sizeof(second));
+        auto* a = new (first) HashPadded{ 7, 9 };
+        auto* b = new (second) HashPadded{ 7, 9 };
+        REQUIRE(std::memcmp(first, second, sizeof(first)) != 0);
+        REQUIRE(TRY_FAIL(Hash(*a)) == TRY_FAIL(Hash(*b)));
+
+        b->small = 8;
+        REQUIRE(TRY_FAIL(Hash(*a)) != TRY_FAIL(Hash(*b)));
+    }
+
+    SECTION("Fields") {
+        HashNamed first{ 1, "first", { 2, 3 } };
+        HashNamed second{ 1, std::string("fir") + "st", { 2, 3 } };
+        REQUIRE(TRY_FAIL(Hash(first)) == TRY_FAIL(Hash(second)));
+
+        // static fields are not part of the value
+        HashNamed::count = 5;
+        REQUIRE(TRY_FAIL(Hash(first)) == TRY_FAIL(Hash(second)));
+
+        second.name = "second";
+        REQUIRE(TRY_FAIL(Hash(first)) != TRY_FAIL(Hash(second)));
+        second.name = "first";
+        second.padded.big = 4;
+        REQUIRE(TRY_FAIL(Hash(first)) != TRY_FAIL(Hash(second)));
+    }
+
+    SECTION("Floating point") {
+        REQUIRE(TRY_FAIL(detail::HashPlanCache::Instance().Get(TRY_FAIL(Reflect<HashFloats>()))).kind == HashPlan::Kind::Fields);
+        REQUIRE(TRY_FAIL(Hash(0.0f)) == TRY_FAIL(Hash(-0.0f)));
+        REQUIRE(TRY_FAIL(Hash(0.0)) == TRY_FAIL(Hash(-0.0)));
+        REQUIRE(TRY_FAIL(Hash(HashFloats{ 0.0f, 1.0f, 0.0 })) == TRY_FAIL(Hash(HashFloats{ -0.0f, 1.0f, -0.0 })));
+        REQUIRE(TRY_FAIL(Hash(1.0f)) != TRY_FAIL(Hash(-1.0f)));
+    }
+
+    SECTION("Bases") {
+        const HashDerived first{ { 1, 2, 3 }, 4 };
+        HashDerived second = first;
+        REQUIRE(TRY_FAIL(Hash(first)) == TRY_FAIL(Hash(second)));
+
+        second.b = 5;
+        REQUIRE(TRY_FAIL(Hash(first)) != TRY_FAIL(Hash(second)));
+
+        // the bytes of a base without reflected fields are hashed too
+        const HashOpaqueDerived opaque{ { 1 }, 2 };
+        const HashOpaqueDerived other{ { 3 }, 2 };
+        REQUIRE(TRY_FAIL(Hash(opaque)) != TRY_FAIL(Hash(other)));
+    }
+
+    SECTION("Equal objects hash the same") {
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const std::vector<HashFloats> floats{
+            { 0.0f, 0.0f, 0.0 }, { -0.0f, 0.0f, -0.0 }, { 1.0f, -0.0f, 2.0 }, { 1.0f, 0.0f, 2.0 }, { nan, 0.0f, 0.0 },
+        };
+        for (const HashFloats& a : floats) {
+            for (const HashFloats& b : floats) {
+                if (TRY_FAIL(Equals(a, b))) {
+                    REQUIRE(TRY_FAIL(Hash(a)) == TRY_FAIL(Hash(b)));
+                }
+            }
+        }
+
+        const std::vector<HashNamed> named{
+            { 1, "one", { 2, 3 } }, { 1, std::string("o") + "ne", { 2, 3 } }, { 1, "one", { 2, 4 } }, { 2, "", {} },
+        };
+        for (const HashNamed& a : named) {
+            for (const HashNamed& b : named) {
+                if (TRY_FAIL(Equals(a, b))) {
+                    REQUIRE(TRY_FAIL(Hash(a)) == TRY_FAIL(Hash(b)));
+                }
+            }
+        }
+
+        const std::vector<HashDerived> derived{ { { 1, 2, 3 }, 4 }, { { 1, 2, 3 }, 4 }, { { 1, 5, 3 }, 4 } };
+        for (const HashDerived& a : derived) {
+            for (const HashDerived& b : derived) {
+                REQUIRE(TRY_FAIL(Equals(a, b)) == (TRY_FAIL(Hash(a)) == TRY_FAIL(Hash(b))));
+            }
+        }
+    }
+
+    SECTION("Variant") {
+        HashNamed named{ 4, "named", { 5, 6 } };
+        const uint64_t expected = TRY_FAIL(Hash(named));
+
+        REQUIRE(TRY_FAIL(Hash(TRY_FAIL(Variant::Create<HashNamed&>(named)))) == expected);
+        REQUIRE(TRY_FAIL(Hash(TRY_FAIL(Variant::Create<const HashNamed&>(named)))) == expected);
+        REQUIRE(TRY_FAIL(Hash(TRY_FAIL(Variant::Create<HashNamed>(HashNamed(named))))) == expected);
+
+        int value = 3;
+        REQUIRE(TRY_FAIL(Hash(TRY_FAIL(Variant::Create<int&>(value)))) == TRY_FAIL(Hash(value)));
+        int* pointer = &value;
+        REQUIRE(TRY_FAIL(Hash(TRY_FAIL(Variant::Create<int*>(pointer)))) == TRY_FAIL(Hash(pointer)));
+
+        REQUIRE(Hash(Variant::Void()).error() == HashError::IsVoid);
+    }
+
+    SECTION("Unsupported") {
+        REQUIRE(Hash(HashUnsupported{}).error() == HashError::Unsupported);
+    }
+}
+}
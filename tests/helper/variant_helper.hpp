@@ -5,14 +5,16 @@
 
 namespace ReflCpp::testing {
 struct VariantTestHelper {
-    template <typename Wrapper_>
-    static Wrapper_* GetWrapper(const Variant& variant) {
-        return dynamic_cast<Wrapper_*>(variant.base_.get());
+    static detail::VariantWrapperType GetWrapperType(const Variant& variant) {
+        return variant.storage_.GetType();
     }
 
-    template <typename Wrapper_>
-    static bool UsesWrapper(const Variant& variant) {
-        return GetWrapper<Wrapper_>(variant) != nullptr;
+    static bool UsesWrapper(const Variant& variant, const detail::VariantWrapperType type) {
+        return GetWrapperType(variant) == type;
+    }
+
+    static bool IsInline(const Variant& variant) {
+        return variant.storage_.IsInline();
     }
 };
 }
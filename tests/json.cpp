@@ -0,0 +1,357 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/json.hpp>
+
+namespace ReflCpp::testing {
+struct JsonInner {
+    bool enabled = false;
+    double ratio = 0.0;
+};
+
+struct JsonOuter {
+    int32_t id = 0;
+    uint8_t level = 0;
+    int64_t big = 0;
+    float scale = 0.0f;
+    std::string name;
+    JsonInner inner;
+    const int version = 1;
+    static int count;
+};
+
+int JsonOuter::count = 0;
+
+struct JsonUnsupported {
+    int* pointer = nullptr;
+};
+
+struct JsonNamedInner : JsonInner {
+    std::string name;
+    // hides the one of the base
+    int32_t ratio = 0;
+};
+
+enum class JsonMode : uint8_t {
+    Off,
+    On = 200,
+};
+
+enum class JsonOffset : int16_t {
+    Behind = -300,
+    Ahead = 300,
+};
+
+struct JsonEnums {
+    JsonMode mode = JsonMode::Off;
+    JsonOffset offset = JsonOffset::Ahead;
+    char letter = 'a';
+};
+
+// bases without reflected fields, only the empty one can be left out
+struct JsonOpaque {
+    uint32_t bits = 0;
+};
+
+struct JsonOpaqueDerived : JsonOpaque {
+    int32_t x = 0;
+};
+
+struct JsonTag {};
+
+struct JsonTagged : JsonTag {
+    int32_t x = 0;
+};
+
+// bases without an offset
+struct JsonUnplacedInner : JsonInner {
+    int32_t id = 0;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonInner){
+    .name = "JsonInner",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonInner::enabled, .name = "enabled" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonInner::ratio, .name = "ratio" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonOuter){
+    .name = "JsonOuter",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::level, .name = "level" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::big, .name = "big" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::scale, .name = "scale" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::inner, .name = "inner" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::version, .name = "version" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonOuter::count, .name = "count" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonUnsupported){
+    .name = "JsonUnsupported",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonUnsupported::pointer, .name = "pointer" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonNamedInner){
+    .name = "JsonNamedInner",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::JsonInner>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::JsonNamedInner, ReflCpp::testing::JsonInner>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonNamedInner::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonNamedInner::ratio, .name = "ratio" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonMode){
+    .name = "JsonMode",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonOffset){
+    .name = "JsonOffset",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonEnums){
+    .name = "JsonEnums",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonEnums::mode, .name = "mode" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonEnums::offset, .name = "offset" },
+        FieldData{ .ptr = &ReflCpp::testing::JsonEnums::letter, .name = "letter" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonUnplacedInner){
+    .name = "JsonUnplacedInner",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::JsonInner>().value() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonUnplacedInner::id, .name = "id" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonOpaque){
+    .name = "JsonOpaque",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonOpaqueDerived){
+    .name = "JsonOpaqueDerived",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::JsonOpaque>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::JsonOpaqueDerived, ReflCpp::testing::JsonOpaque>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonOpaqueDerived::x, .name = "x" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonTag){
+    .name = "JsonTag",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::JsonTagged){
+    .name = "JsonTagged",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::JsonTag>().value() },
+    .baseOffsets = { ReflCpp::BaseOffset<ReflCpp::testing::JsonTagged, ReflCpp::testing::JsonTag>() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::JsonTagged::x, .name = "x" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+#define TRY_FAIL(...) \
+    RESCPP_TRY_IMPL((__VA_ARGS__), { \
+        FAIL("result was bad\n" << std::stacktrace::current(1)); \
+    })
+
+namespace ReflCpp::testing {
+TEST_CASE("JSON Tests", "[json]") {
+    SECTION("Write") {
+        JsonOuter outer;
+        outer.id = -5;
+        outer.level = 200;
+        outer.big = 1234567890123;
+        outer.scale = 0.5f;
+        outer.name = "quote \" slash \\ line\n\x01";
+        outer.inner = { true, 0.25 };
+
+        std::ostringstream stream;
+        TRY_FAIL(WriteJson(outer, stream));
+        REQUIRE(stream.str() == R"({"id":-5,"level":200,"big":1234567890123,"scale":0.5,)"
+                                R"("name":"quote \" slash \\ line\n\u0001",)"
+                                R"("inner":{"enabled":true,"ratio":0.25},"version":1})");
+    }
+
+    SECTION("Round trip") {
+        JsonOuter outer;
+        outer.id = 42;
+        outer.scale = 3.14159f;
+        outer.name = "caf\xC3\xA9 \t tab";
+        outer.inner.ratio = 1e-300;
+
+        std::ostringstream stream;
+        TRY_FAIL(WriteJson(outer, stream));
+        const std::string json = stream.str();
+
+        JsonOuter read;
+        REQUIRE(TRY_FAIL(ReadJson(json, read)) == json.size());
+        REQUIRE(read.id == 42);
+        REQUIRE(read.scale == 3.14159f);
+        REQUIRE(read.name == outer.name);
+        REQUIRE(read.inner.ratio == 1e-300);
+    }
+
+    SECTION("Read") {
+        constexpr std::string_view json = R"( {
+            "unknown": [1, {"a": [true, null]}, "x"],
+            "name": "é😀\/",
+            "inner": { "enabled": true },
+            "level": 7,
+            "version": 99,
+            "big": null,
+            "id": -12
+        } )";
+
+        JsonOuter read;
+        read.big = 77;
+        REQUIRE(TRY_FAIL(ReadJson(json, read)) == json.size());
+        REQUIRE(read.id == -12);
+        REQUIRE(read.level == 7);
+        REQUIRE(read.name == "\xC3\xA9\xF0\x9F\x98\x80/");
+        REQUIRE(read.inner.enabled);
+        // null and const fields keep their value
+        REQUIRE(read.big == 77);
+        REQUIRE(read.version == 1);
+    }
+
+    SECTION("Bases") {
+        JsonNamedInner named;
+        named.enabled = true;
+        named.JsonInner::ratio = 0.5;
+        named.name = "named";
+        named.ratio = 3;
+
+        std::ostringstream stream;
+        TRY_FAIL(WriteJson(named, stream));
+        REQUIRE(stream.str() == R"({"enabled":true,"name":"named","ratio":3})");
+
+        JsonNamedInner read;
+        REQUIRE(TRY_FAIL(ReadJson(R"({"ratio":7,"enabled":true,"name":"read"})", read)) == 40);
+        REQUIRE(read.enabled);
+        REQUIRE(read.name == "read");
+        REQUIRE(read.ratio == 7);
+        REQUIRE(read.JsonInner::ratio == 0.0);
+
+        // empty bases add nothing
+        std::ostringstream tagged;
+        TRY_FAIL(WriteJson(JsonTagged{ {}, 3 }, tagged));
+        REQUIRE(tagged.str() == R"({"x":3})");
+    }
+
+    SECTION("Enums") {
+        JsonEnums enums;
+        enums.mode = JsonMode::On;
+        enums.offset = JsonOffset::Behind;
+
+        // written as their value, with the signedness of their underlying type
+        std::ostringstream stream;
+        TRY_FAIL(WriteJson(enums, stream));
+        REQUIRE(stream.str() == R"({"mode":200,"offset":-300,"letter":97})");
+
+        JsonEnums read;
+        REQUIRE(TRY_FAIL(ReadJson(stream.str(), read)) == stream.str().size());
+        REQUIRE(read.mode == JsonMode::On);
+        REQUIRE(read.offset == JsonOffset::Behind);
+        REQUIRE(read.letter == 'a');
+        REQUIRE(ReadJson(R"({"mode":-1})", read).error() == JsonError::InvalidNumber);
+    }
+
+    SECTION("Objects one after another") {
+        const std::string_view lines = "{\"id\":1}\n{\"id\":2}\n";
+        JsonOuter first;
+        JsonOuter second;
+        const size_t taken = TRY_FAIL(ReadJson(lines, first));
+        REQUIRE(TRY_FAIL(ReadJson(lines.substr(taken), second)) == lines.size() - taken);
+        REQUIRE(first.id == 1);
+        REQUIRE(second.id == 2);
+    }
+
+    SECTION("Errors") {
+        JsonOuter read;
+        REQUIRE(ReadJson(R"({"id":1)", read).error() == JsonError::UnexpectedEnd);
+        REQUIRE(ReadJson(R"({"id" 1})", read).error() == JsonError::UnexpectedCharacter);
+        REQUIRE(ReadJson(R"({"id":1.5})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"level":256})", read).error() == JsonError::NumberOutOfRange);
+        REQUIRE(ReadJson(R"({"level":-1})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"name":"\x"})", read).error() == JsonError::InvalidString);
+        REQUIRE(ReadJson(R"({"name":"\ud83d"})", read).error() == JsonError::InvalidString);
+        REQUIRE(ReadJson("[1]", read).error() == JsonError::UnexpectedCharacter);
+
+        // what from_chars takes beyond the JSON grammar
+        REQUIRE(ReadJson(R"({"scale":inf})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"scale":nan})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"scale":-infinity})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"scale":1.})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"scale":.5})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"scale":1e})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(ReadJson(R"({"id":007})", read).error() == JsonError::UnexpectedCharacter);
+        REQUIRE(ReadJson(R"({"unknown":+1})", read).error() == JsonError::InvalidNumber);
+        REQUIRE(TRY_FAIL(ReadJson(R"({"scale":-0.5e+1})", read)) == 17);
+        REQUIRE(read.scale == -5.0f);
+
+        // control characters have to be escaped
+        REQUIRE(ReadJson("{\"name\":\"tab\there\"}", read).error() == JsonError::InvalidString);
+        REQUIRE(ReadJson("{\"name\":\"\\n\nline\"}", read).error() == JsonError::InvalidString);
+
+        const std::string deep = R"({"unknown":)" + std::string(300, '[') + std::string(300, ']') + "}";
+        REQUIRE(ReadJson(deep, read).error() == JsonError::TooDeep);
+
+        std::ostringstream stream;
+        REQUIRE(WriteJson(JsonUnsupported{}, stream).error() == JsonError::Unsupported);
+        REQUIRE(WriteJson(JsonUnplacedInner{}, stream).error() == JsonError::Unsupported);
+        // its data would be left out
+        REQUIRE(WriteJson(JsonOpaqueDerived{}, stream).error() == JsonError::Unsupported);
+    }
+}
+}
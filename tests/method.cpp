@@ -1,11 +1,15 @@
 #include <catch2/catch_test_macros.hpp>
 #include <string>
 #include <memory>
+#include <new>
+#include <span>
+#include <vector>
 
 #include "refl-cpp/type.hpp"
 #include "refl-cpp/field.hpp"
 #include "refl-cpp/method.hpp"
 #include "refl-cpp/variant.hpp"
+#include "refl-cpp/thread_pool.hpp"
 
 // Test classes
 namespace TestClasses {
@@ -41,6 +45,11 @@ public:
         return a + b;
     }
 
+    [[nodiscard]]
+    std::string add(const std::string& a, const std::string& b) const {
+        return a + b;
+    }
+
     void setName(const std::string& newName) {
         name = newName;
     }
@@ -63,6 +72,79 @@ public:
 
     InnerClass inner;
 };
+
+// Parameters of every reference kind, for passing native arguments
+class ArgumentClass {
+public:
+    std::string name = "Default";
+    int count = 0;
+
+    void takeName(std::string&& newName) {
+        name = std::move(newName);
+    }
+
+    void appendNameTo(std::string& out) const {
+        out += name;
+    }
+
+    void bump(int& value) const {
+        value += count;
+    }
+
+    void takeCount(int&& value) {
+        count = value;
+    }
+
+    void setCount(const int value) {
+        count = value;
+    }
+
+    std::string releaseName() && {
+        return std::move(name);
+    }
+
+    void resetCount() & {
+        count = 0;
+    }
+};
+
+// Returns references, for results written into return slots
+class ReferenceClass {
+public:
+    std::vector<int> values{ 1, 2, 3 };
+    std::string name = "Default";
+
+    int& at(const size_t index) {
+        return values[index];
+    }
+
+    [[nodiscard]]
+    const std::string& getName() const {
+        return name;
+    }
+};
+
+// Copying a value into an existing one fails, like a string running out of memory would
+struct FailingCopy {
+    FailingCopy() = default;
+    FailingCopy(const FailingCopy&) = default;
+
+    FailingCopy& operator=(const FailingCopy&) {
+        throw std::bad_alloc();
+    }
+};
+
+class FailingCopyClass {
+public:
+    FailingCopy value;
+};
+
+// Standard layout, so its fields can be accessed by offset
+struct LayoutClass {
+    int id = 1;
+    float weight = 2.5f;
+    const double scale = 3.0;
+};
 } // namespace TestClasses
 
 REFLCPP_REFLECT_TEMPLATE()
@@ -143,7 +225,12 @@ REFLCPP_REFLECT_DATA(TestClasses::SimpleClass){
             .name = "add",
             .funcs = {
                 MethodFuncData{
-                    .ptr = &TestClasses::SimpleClass::add,
+                    .ptr = static_cast<int (TestClasses::SimpleClass::*)(int, int) const>(&TestClasses::SimpleClass::add),
+                    .args = { "a", "b" },
+                },
+                MethodFuncData{
+                    .ptr = static_cast<std::string (TestClasses::SimpleClass::*)(const std::string&, const std::string&) const>(
+                        &TestClasses::SimpleClass::add),
                     .args = { "a", "b" },
                 }
             },
@@ -169,6 +256,122 @@ REFLCPP_REFLECT_DATA(TestClasses::SimpleClass){
 }
 REFLCPP_REFLECT_DATA_END()
 
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(TestClasses::ArgumentClass){
+    .name = "ArgumentClass",
+    ._namespace = "TestClasses",
+    .methods = {
+        MethodData{
+            .name = "takeName",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ArgumentClass::takeName,
+                    .args = { "newName" },
+                }
+            },
+        },
+        MethodData{
+            .name = "appendNameTo",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ArgumentClass::appendNameTo,
+                    .args = { "out" },
+                }
+            },
+        },
+        MethodData{
+            .name = "bump",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ArgumentClass::bump,
+                    .args = { "value" },
+                }
+            },
+        },
+        MethodData{
+            .name = "takeCount",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ArgumentClass::takeCount,
+                    .args = { "value" },
+                }
+            },
+        },
+        MethodData{
+            .name = "setCount",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ArgumentClass::setCount,
+                    .args = { "value" },
+                }
+            },
+        },
+        MethodData{
+            .name = "releaseName",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ArgumentClass::releaseName,
+                }
+            },
+        },
+        MethodData{
+            .name = "resetCount",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ArgumentClass::resetCount,
+                }
+            },
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(TestClasses::ReferenceClass){
+    .name = "ReferenceClass",
+    ._namespace = "TestClasses",
+    .methods = {
+        MethodData{
+            .name = "at",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ReferenceClass::at,
+                    .args = { "index" },
+                }
+            },
+        },
+        MethodData{
+            .name = "getName",
+            .funcs = {
+                MethodFuncData{
+                    .ptr = &TestClasses::ReferenceClass::getName,
+                }
+            },
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(TestClasses::FailingCopy){
+    .name = "FailingCopy",
+    ._namespace = "TestClasses",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(TestClasses::FailingCopyClass){
+    .name = "FailingCopyClass",
+    ._namespace = "TestClasses",
+    .fields = {
+        FieldData{
+            .ptr = &TestClasses::FailingCopyClass::value,
+            .name = "value",
+        }
+    }
+}
+REFLCPP_REFLECT_DATA_END()
+
 REFLCPP_REFLECT_TEMPLATE()
 REFLCPP_REFLECT_DATA(TestClasses::ContainerClass){
     .name = "ContainerClass",
@@ -189,6 +392,27 @@ REFLCPP_REFLECT_DATA(TestClasses::ContainerClass::InnerClass){
 }
 REFLCPP_REFLECT_DATA_END()
 
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(TestClasses::LayoutClass){
+    .name = "LayoutClass",
+    ._namespace = "TestClasses",
+    .fields = {
+        FieldData{
+            .ptr = &TestClasses::LayoutClass::id,
+            .name = "id",
+        },
+        FieldData{
+            .ptr = &TestClasses::LayoutClass::weight,
+            .name = "weight",
+        },
+        FieldData{
+            .ptr = &TestClasses::LayoutClass::scale,
+            .name = "scale",
+        }
+    }
+}
+REFLCPP_REFLECT_DATA_END()
+
 #define TRY_FAIL(...) \
     RESCPP_TRY_IMPL((__VA_ARGS__), { \
         FAIL("result was bad\n" << std::stacktrace::current(1)); \
@@ -211,6 +435,13 @@ TEST_CASE("Field reflection tests", "[field]") {
 
         auto nonExistentField = testType.GetField("nonExistent");
         REQUIRE_FALSE(nonExistentField.has_value());
+
+        // names built at runtime match too, not only the literal used for reflecting
+        const std::string runtimeName = std::string("public") + "Value";
+        auto runtimeField = testType.GetField(runtimeName);
+        REQUIRE(runtimeField.has_value());
+        REQUIRE(&runtimeField->get() == &publicValueField->get());
+        REQUIRE_FALSE(testType.GetField("publicValu").has_value());
     }
 
     SECTION("GetValue for instance field") {
@@ -312,6 +543,136 @@ TEST_CASE("Field reflection tests", "[field]") {
     }
 }
 
+TEST_CASE("Field accessor tests", "[field]") {
+    TestClasses::LayoutClass instance;
+    const ReflCpp::Type& layoutType = TRY_FAIL(ReflCpp::Reflect<TestClasses::LayoutClass>());
+
+    SECTION("Type layout") {
+        const ReflCpp::TypeLayout& layout = layoutType.GetLayout();
+        REQUIRE(layout.size == sizeof(TestClasses::LayoutClass));
+        REQUIRE(layout.alignment == alignof(TestClasses::LayoutClass));
+        REQUIRE(layout.standardLayout);
+        REQUIRE(layout.triviallyCopyable);
+        REQUIRE_FALSE(TRY_FAIL(ReflCpp::Reflect<TestClasses::SimpleClass>()).GetLayout().standardLayout);
+
+        const ReflCpp::Type& intType = TRY_FAIL(ReflCpp::Reflect<int>());
+        REQUIRE(intType.GetLayout().size == sizeof(int));
+        REQUIRE(intType.GetLayout().triviallyCopyable);
+
+        const ReflCpp::Type& refType = TRY_FAIL(ReflCpp::Reflect<int&>());
+        REQUIRE(refType.GetLayout().size == 0);
+    }
+
+    SECTION("Offsets") {
+        const ReflCpp::Field& weight = layoutType.GetField("weight")->get();
+        REQUIRE(weight.GetOffset() == offsetof(TestClasses::LayoutClass, weight));
+        REQUIRE(weight.GetSize() == sizeof(float));
+        REQUIRE(layoutType.GetField("scale")->get().GetOffset() == offsetof(TestClasses::LayoutClass, scale));
+
+        // not standard layout or static
+        const ReflCpp::Type& simpleType = TRY_FAIL(ReflCpp::Reflect<TestClasses::SimpleClass>());
+        REQUIRE_FALSE(simpleType.GetField("publicValue")->get().GetOffset().has_value());
+        REQUIRE_FALSE(simpleType.GetField("staticValue")->get().GetOffset().has_value());
+        REQUIRE(simpleType.GetField("staticValue")->get().GetSize() == sizeof(int));
+    }
+
+    SECTION("Read and write") {
+        const auto weight = layoutType.GetField("weight")->get().Accessor<float>();
+        REQUIRE(weight.has_value());
+        REQUIRE(weight->Get(&instance) == 2.5f);
+
+        weight->Set(&instance, 4.0f);
+        REQUIRE(instance.weight == 4.0f);
+        weight->Ref(&instance) += 1.0f;
+        REQUIRE(instance.weight == 5.0f);
+
+        const auto scale = layoutType.GetField("scale")->get().Accessor<const double>();
+        REQUIRE(scale.has_value());
+        REQUIRE(scale->Get(&instance) == 3.0);
+
+        // reading a mutable field through a const accessor is fine
+        const auto id = layoutType.GetField("id")->get().Accessor<const int>();
+        REQUIRE(id.has_value());
+        REQUIRE(id->Get(&instance) == 1);
+    }
+
+    SECTION("Mismatches") {
+        const ReflCpp::Field& weight = layoutType.GetField("weight")->get();
+        REQUIRE_FALSE(weight.Accessor<int>().has_value());
+        REQUIRE_FALSE(weight.Accessor<double>().has_value());
+
+        // a const field can not be written
+        REQUIRE(layoutType.GetField("scale")->get().IsConst());
+        REQUIRE_FALSE(layoutType.GetField("scale")->get().Accessor<double>().has_value());
+
+        const ReflCpp::Type& simpleType = TRY_FAIL(ReflCpp::Reflect<TestClasses::SimpleClass>());
+        REQUIRE_FALSE(simpleType.GetField("publicValue")->get().Accessor<int>().has_value());
+    }
+}
+
+TEST_CASE("Field column tests", "[field]") {
+    std::vector<TestClasses::LayoutClass> instances(5);
+    for (size_t i = 0; i < instances.size(); ++i) {
+        instances[i].id = static_cast<int>(i);
+    }
+    const ReflCpp::Type& layoutType = TRY_FAIL(ReflCpp::Reflect<TestClasses::LayoutClass>());
+    const ReflCpp::Field& idField = layoutType.GetField("id")->get();
+
+    SECTION("Gather and scatter") {
+        std::vector<int> ids(instances.size());
+        TRY_FAIL(idField.Gather(std::span<const TestClasses::LayoutClass>(instances), std::span(ids)));
+        REQUIRE(ids == std::vector{ 0, 1, 2, 3, 4 });
+
+        for (auto& id : ids) {
+            id *= 10;
+        }
+        TRY_FAIL(idField.Scatter(std::span<const int>(ids), std::span(instances)));
+        REQUIRE(instances[3].id == 30);
+        REQUIRE(instances[3].weight == 2.5f);
+
+        // const fields can be gathered, but not scattered
+        const ReflCpp::Field& scaleField = layoutType.GetField("scale")->get();
+        std::vector<double> scales(instances.size());
+        TRY_FAIL(scaleField.Gather(std::span(instances), std::span(scales)));
+        REQUIRE(scales[4] == 3.0);
+        REQUIRE(scaleField.Scatter(std::span(scales), std::span(instances)).error() == ReflCpp::FieldColumnError::IsConst);
+    }
+
+    SECTION("Classes without a known offset") {
+        std::vector<TestClasses::SimpleClass> simples(3);
+        simples[1].name = "second";
+        const ReflCpp::Type& simpleType = TRY_FAIL(ReflCpp::Reflect<TestClasses::SimpleClass>());
+
+        std::vector<std::string> names(simples.size());
+        TRY_FAIL(simpleType.GetField("name")->get().Gather(std::span(simples), std::span(names)));
+        REQUIRE(names[0] == "Default");
+        REQUIRE(names[1] == "second");
+
+        std::vector<int> values(simples.size());
+        REQUIRE(simpleType.GetField("staticValue")->get().Gather(std::span(simples), std::span(values)).has_error());
+    }
+
+    SECTION("Copies that throw") {
+        const ReflCpp::Type& failingType = TRY_FAIL(ReflCpp::Reflect<TestClasses::FailingCopyClass>());
+        const ReflCpp::Field& valueField = failingType.GetField("value")->get();
+        std::vector<TestClasses::FailingCopyClass> failing(2);
+        std::vector<TestClasses::FailingCopy> values(failing.size());
+        REQUIRE(valueField.Gather(std::span(failing), std::span(values)).error() == ReflCpp::FieldColumnError::OutOfMemory);
+        REQUIRE(valueField.Scatter(std::span(values), std::span(failing)).error() == ReflCpp::FieldColumnError::OutOfMemory);
+    }
+
+    SECTION("Mismatches") {
+        std::vector<float> floats(instances.size());
+        REQUIRE(idField.Gather(std::span(instances), std::span(floats)).error() == ReflCpp::FieldColumnError::TypeMismatch);
+
+        std::vector<int> ids(instances.size() - 1);
+        REQUIRE(idField.Gather(std::span(instances), std::span(ids)).error() == ReflCpp::FieldColumnError::SizeMismatch);
+
+        std::vector<TestClasses::ContainerClass::InnerClass> others(ids.size());
+        REQUIRE(idField.Gather(std::span(others), std::span(ids)).error() == ReflCpp::FieldColumnError::ClassMismatch);
+    }
+}
+
 TEST_CASE("Method reflection tests", "[method]") {
     TestClasses::SimpleClass testInstance;
     const ReflCpp::Type& testType = TRY_FAIL(ReflCpp::Reflect<TestClasses::SimpleClass>());
@@ -329,6 +690,15 @@ TEST_CASE("Method reflection tests", "[method]") {
 
         auto nonExistentMethod = testType.GetMethod("nonExistent");
         REQUIRE_FALSE(nonExistentMethod.has_value());
+
+        // every reflected method can be found by a name built at runtime,
+        // if a name is used twice the first one is returned
+        for (const auto& method : testType.GetMethods()) {
+            auto found = testType.GetMethod(std::string(method.GetName()));
+            REQUIRE(found.has_value());
+            REQUIRE(std::string_view(found->get().GetName()) == method.GetName());
+            REQUIRE(&found->get() <= &method);
+        }
     }
 
     SECTION("Invoke instance method with no parameters") {
@@ -430,4 +800,475 @@ TEST_CASE("Method reflection tests", "[method]") {
         // Check that the method executed correctly
         REQUIRE(testInstance.getName() == "TestName");
     }
+
+    SECTION("Invoke static method without object") {
+        auto getStaticValue = testType.GetMethod("getStaticValue");
+        REQUIRE(getStaticValue.has_value());
+
+        auto result = getStaticValue->get().Invoke(ReflCpp::ArgumentList{});
+        REQUIRE(!result.has_error());
+        REQUIRE(TRY_FAIL(result.value().Get<int>()) == TestClasses::SimpleClass::staticValue);
+
+        // only static functions can be invoked without an object
+        auto getValue = testType.GetMethod("getValue");
+        REQUIRE(getValue.has_value());
+        REQUIRE(getValue->get().Invoke(ReflCpp::ArgumentList{}).has_error());
+    }
+
+    SECTION("Invoke with argument pack") {
+        auto add = testType.GetMethod("add");
+        REQUIRE(add.has_value());
+
+        ReflCpp::ArgumentPack pack{
+            TRY_FAIL(ReflCpp::Variant::Create<int>(40)),
+            TRY_FAIL(ReflCpp::Variant::Create<int>(2)),
+        };
+        static_assert(std::is_same_v<decltype(pack), ReflCpp::ArgumentPack<2>>);
+        REQUIRE(pack.Size() == 2);
+        const auto packed = TRY_FAIL(add->get().Invoke(instanceVariant, pack));
+        REQUIRE(TRY_FAIL(packed.Get<int>()) == 42);
+
+        // braced lists work without building an 'ArgumentList'
+        auto result = add->get().Invoke(instanceVariant, {
+            TRY_FAIL(ReflCpp::Variant::Create<int>(1)),
+            TRY_FAIL(ReflCpp::Variant::Create<int>(2)),
+        });
+        const auto sum = TRY_FAIL(result);
+        REQUIRE(TRY_FAIL(sum.Get<int>()) == 3);
+
+        ReflCpp::ArgumentPack<3> partial;
+        REQUIRE(partial.Push(TRY_FAIL(ReflCpp::Variant::Create<std::string>("a"))));
+        REQUIRE(partial.Push(TRY_FAIL(ReflCpp::Variant::Create<std::string>("b"))));
+        const auto joined = TRY_FAIL(add->get().Invoke(instanceVariant, partial));
+        REQUIRE(TRY_FAIL(joined.Get<std::string>()) == "ab");
+
+        REQUIRE(partial.Push(TRY_FAIL(ReflCpp::Variant::Create<std::string>("c"))));
+        REQUIRE_FALSE(partial.Push(TRY_FAIL(ReflCpp::Variant::Create<std::string>("d"))));
+        REQUIRE(partial.Size() == 3);
+
+        // copies keep their own heap values alive
+        const auto copy = partial;
+        partial.Clear();
+        REQUIRE(partial.Size() == 0);
+        REQUIRE(TRY_FAIL(copy[2].Get<std::string>()) == "c");
+    }
+
+    SECTION("Invoke with native arguments") {
+        auto add = testType.GetMethod("add");
+        REQUIRE(add.has_value());
+
+        // the object and the arguments are referred to, not copied
+        const int a = 40;
+        const auto answer = TRY_FAIL(add->get().Invoke(testInstance, a, 2));
+        REQUIRE(TRY_FAIL(answer.Get<int>()) == 42);
+
+        const std::string prefix = "pre";
+        const auto joined = TRY_FAIL(add->get().Invoke(instanceVariant, prefix, std::string("fix")));
+        REQUIRE(TRY_FAIL(joined.Get<std::string>()) == "prefix");
+
+        // variants can be mixed with native arguments
+        const auto two = TRY_FAIL(ReflCpp::Variant::Create<int>(2));
+        const auto mixed = TRY_FAIL(add->get().Invoke(testInstance, 1, two));
+        REQUIRE(TRY_FAIL(mixed.Get<int>()) == 3);
+
+        auto setValue = testType.GetMethod("setValue");
+        REQUIRE(setValue.has_value());
+        REQUIRE(!setValue->get().Invoke(testInstance, 77).has_error());
+        REQUIRE(testInstance.getValue() == 77);
+
+        auto getValue = testType.GetMethod("getValue");
+        REQUIRE(getValue.has_value());
+        const auto value = TRY_FAIL(getValue->get().Invoke(testInstance));
+        REQUIRE(TRY_FAIL(value.Get<int>()) == 77);
+
+        // arguments of no overload still fail
+        REQUIRE(add->get().Invoke(testInstance, 1, prefix).has_error());
+    }
+
+    SECTION("Invoke with native arguments of every value category") {
+        TestClasses::ArgumentClass arguments;
+        const ReflCpp::Type& argumentType = TRY_FAIL(ReflCpp::Reflect<TestClasses::ArgumentClass>());
+
+        // temporaries stay rvalues, so they bind to rvalue references but not to mutable lvalue references
+        auto takeName = argumentType.GetMethod("takeName");
+        REQUIRE(takeName.has_value());
+        REQUIRE(!takeName->get().Invoke(arguments, std::string("temporary")).has_error());
+        REQUIRE(arguments.name == "temporary");
+        std::string named = "named";
+        REQUIRE(takeName->get().Invoke(arguments, named).has_error());
+        REQUIRE(!takeName->get().Invoke(arguments, std::move(named)).has_error());
+        REQUIRE(arguments.name == "named");
+
+        auto appendNameTo = argumentType.GetMethod("appendNameTo");
+        REQUIRE(appendNameTo.has_value());
+        std::string out = "-";
+        REQUIRE(!appendNameTo->get().Invoke(arguments, out).has_error());
+        REQUIRE(out == "-named");
+        REQUIRE(appendNameTo->get().Invoke(arguments, std::string("-")).has_error());
+
+        // small values are copied into the variant, but keep their category too
+        arguments.count = 2;
+        auto bump = argumentType.GetMethod("bump");
+        REQUIRE(bump.has_value());
+        int value = 1;
+        REQUIRE(!bump->get().Invoke(arguments, value).has_error());
+        REQUIRE(value == 3);
+        const int constant = 10;
+        REQUIRE(bump->get().Invoke(arguments, constant).has_error());
+        REQUIRE(bump->get().Invoke(arguments, 5).has_error());
+
+        auto takeCount = argumentType.GetMethod("takeCount");
+        REQUIRE(takeCount.has_value());
+        REQUIRE(!takeCount->get().Invoke(arguments, 5).has_error());
+        REQUIRE(arguments.count == 5);
+        REQUIRE(takeCount->get().Invoke(arguments, value).has_error());
+        REQUIRE(takeCount->get().Invoke(arguments, constant).has_error());
+
+        auto setCount = argumentType.GetMethod("setCount");
+        REQUIRE(setCount.has_value());
+        REQUIRE(!setCount->get().Invoke(arguments, constant).has_error());
+        REQUIRE(arguments.count == 10);
+        REQUIRE(!setCount->get().Invoke(arguments, 7).has_error());
+        REQUIRE(arguments.count == 7);
+        REQUIRE(!setCount->get().Invoke(arguments, value).has_error());
+        REQUIRE(arguments.count == 3);
+
+        // temporary objects go to methods qualified with '&&' or without a reference qualifier,
+        // but not to ones qualified with '&'
+        auto releaseName = argumentType.GetMethod("releaseName");
+        REQUIRE(releaseName.has_value());
+        const ReflCpp::Variant released = TRY_FAIL(releaseName->get().Invoke(TestClasses::ArgumentClass{ "released", 0 }));
+        REQUIRE(TRY_FAIL(released.Get<std::string>()) == "released");
+        REQUIRE(releaseName->get().Invoke(arguments).has_error());
+        REQUIRE(!releaseName->get().Invoke(std::move(arguments)).has_error());
+
+        auto resetCount = argumentType.GetMethod("resetCount");
+        REQUIRE(resetCount.has_value());
+        REQUIRE(resetCount->get().Invoke(TestClasses::ArgumentClass{}).has_error());
+        REQUIRE(!resetCount->get().Invoke(arguments).has_error());
+        REQUIRE(arguments.count == 0);
+
+        REQUIRE(!setCount->get().Invoke(TestClasses::ArgumentClass{}, 4).has_error());
+    }
+
+    SECTION("Invoke into a return slot") {
+        auto getValue = testType.GetMethod("getValue");
+        REQUIRE(getValue.has_value());
+        testInstance.setValue(5);
+
+        // a typed slot is written through
+        int out = 0;
+        REQUIRE(!getValue->get().InvokeInto(instanceVariant, {}, out).has_error());
+        REQUIRE(out == 5);
+
+        // as is a variant slot of the return type, which keeps its storage
+        ReflCpp::Variant slot = TRY_FAIL(ReflCpp::Variant::Create<std::string>("previous"));
+        const std::string* storage = &TRY_FAIL(slot.Get<std::string&>());
+        auto getName = testType.GetMethod("getName");
+        REQUIRE(getName.has_value());
+        testInstance.setName("slot");
+        REQUIRE(!getName->get().InvokeInto(instanceVariant, {}, slot).has_error());
+        REQUIRE(TRY_FAIL(slot.Get<std::string>()) == "slot");
+        REQUIRE(&TRY_FAIL(slot.Get<std::string&>()) == storage);
+
+        // unless copies of the slot share its value, which then keep the old one
+        const ReflCpp::Variant copy = slot;
+        REQUIRE(copy.IsShared());
+        testInstance.setName("replaced");
+        REQUIRE(!getName->get().InvokeInto(instanceVariant, {}, slot).has_error());
+        REQUIRE(TRY_FAIL(slot.Get<std::string>()) == "replaced");
+        REQUIRE(TRY_FAIL(copy.Get<std::string>()) == "slot");
+        REQUIRE(!slot.IsShared());
+        testInstance.setName("again");
+        REQUIRE(!getName->get().InvokeInto(instanceVariant, {}, slot).has_error());
+        REQUIRE(TRY_FAIL(slot.Get<std::string>()) == "again");
+        REQUIRE(TRY_FAIL(copy.Get<std::string>()) == "slot");
+
+        // value slots of another type are replaced
+        REQUIRE(!getValue->get().InvokeInto(instanceVariant, {}, slot).has_error());
+        REQUIRE(TRY_FAIL(slot.Get<int>()) == 5);
+
+        auto getStaticValue = testType.GetMethod("getStaticValue");
+        REQUIRE(getStaticValue.has_value());
+        REQUIRE(!getStaticValue->get().InvokeInto({}, out).has_error());
+        REQUIRE(out == TestClasses::SimpleClass::staticValue);
+
+        // storage of the caller is never replaced
+        std::string wrongType;
+        auto result = getValue->get().InvokeInto(instanceVariant, {}, wrongType);
+        REQUIRE(result.has_error());
+        REQUIRE(result.error().type == ReflCpp::FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+
+        // functions without result clear value slots
+        auto setValue = testType.GetMethod("setValue");
+        REQUIRE(setValue.has_value());
+        const ReflCpp::ArgumentPack args{ TRY_FAIL(ReflCpp::Variant::Create<int>(9)) };
+        REQUIRE(!setValue->get().InvokeInto(instanceVariant, args, slot).has_error());
+        REQUIRE(slot.IsVoid());
+        REQUIRE(testInstance.getValue() == 9);
+    }
+
+    SECTION("Invoke reference getters into a return slot") {
+        TestClasses::ReferenceClass references;
+        const ReflCpp::Type& referenceType = TRY_FAIL(ReflCpp::Reflect<TestClasses::ReferenceClass>());
+        const ReflCpp::Variant referencesVariant = TRY_FAIL(ReflCpp::Variant::Create<TestClasses::ReferenceClass&>(references));
+
+        // the slot gets a copy of the element, so the next call does not assign through it
+        auto at = referenceType.GetMethod("at");
+        REQUIRE(at.has_value());
+        ReflCpp::Variant slot = ReflCpp::Variant::Void();
+        const ReflCpp::ArgumentPack first{ TRY_FAIL(ReflCpp::Variant::Create<size_t>(0)) };
+        REQUIRE(!at->get().InvokeInto(referencesVariant, first, slot).has_error());
+        REQUIRE(TRY_FAIL(slot.Get<int>()) == 1);
+        const ReflCpp::ArgumentPack second{ TRY_FAIL(ReflCpp::Variant::Create<size_t>(1)) };
+        REQUIRE(!at->get().InvokeInto(referencesVariant, second, slot).has_error());
+        REQUIRE(TRY_FAIL(slot.Get<int>()) == 2);
+        REQUIRE(references.values == std::vector<int>{ 1, 2, 3 });
+
+        auto getName = referenceType.GetMethod("getName");
+        REQUIRE(getName.has_value());
+        ReflCpp::Variant nameSlot = ReflCpp::Variant::Void();
+        REQUIRE(!getName->get().InvokeInto(referencesVariant, {}, nameSlot).has_error());
+        REQUIRE(TRY_FAIL(nameSlot.Get<std::string>()) == "Default");
+        references.name = "changed";
+        REQUIRE(!getName->get().InvokeInto(referencesVariant, {}, nameSlot).has_error());
+        REQUIRE(TRY_FAIL(nameSlot.Get<std::string>()) == "changed");
+        references.name = "after";
+        REQUIRE(TRY_FAIL(nameSlot.Get<std::string>()) == "changed");
+
+        // the same holds for slots reused by a batch
+        std::vector<TestClasses::ReferenceClass> instances(3);
+        instances[1].values[0] = 5;
+        std::vector<ReflCpp::Variant> results(instances.size(), ReflCpp::Variant::Void());
+        REQUIRE(!at->get().InvokeBatch(std::span(instances), first, results).has_error());
+        REQUIRE(!at->get().InvokeBatch(std::span(instances), second, results).has_error());
+        REQUIRE(TRY_FAIL(results[1].Get<int>()) == 2);
+        REQUIRE(instances[1].values == std::vector<int>{ 5, 2, 3 });
+    }
+
+    SECTION("Batch invoke") {
+        auto setValue = testType.GetMethod("setValue");
+        REQUIRE(setValue.has_value());
+        auto getValue = testType.GetMethod("getValue");
+        REQUIRE(getValue.has_value());
+
+        std::vector<TestClasses::SimpleClass> instances(4);
+        const ReflCpp::ArgumentPack args{ TRY_FAIL(ReflCpp::Variant::Create<int>(7)) };
+        REQUIRE(!setValue->get().InvokeBatch(std::span(instances), args).has_error());
+        for (const auto& instance : instances) {
+            REQUIRE(instance.getValue() == 7);
+        }
+
+        // results are collected per instance
+        instances[2].setValue(3);
+        std::vector<ReflCpp::Variant> results(instances.size(), ReflCpp::Variant::Void());
+        REQUIRE(!getValue->get().InvokeBatch(std::span(instances), {}, results).has_error());
+        REQUIRE(TRY_FAIL(results[1].Get<int>()) == 7);
+        REQUIRE(TRY_FAIL(results[2].Get<int>()) == 3);
+
+        // too few result slots
+        results.pop_back();
+        REQUIRE(getValue->get().InvokeBatch(std::span(instances), {}, results).has_error());
+
+        // objects held by variants
+        TestClasses::SimpleClass other;
+        const std::vector<ReflCpp::Variant> variants{
+            instanceVariant,
+            TRY_FAIL(ReflCpp::Variant::Create<TestClasses::SimpleClass&>(other)),
+        };
+        const ReflCpp::ArgumentPack nine{ TRY_FAIL(ReflCpp::Variant::Create<int>(9)) };
+        REQUIRE(!setValue->get().InvokeBatch(variants, nine).has_error());
+        REQUIRE(testInstance.getValue() == 9);
+        REQUIRE(other.getValue() == 9);
+
+        // nothing is invoked if any of the objects is invalid
+        const std::vector<ReflCpp::Variant> invalid{
+            instanceVariant,
+            TRY_FAIL(ReflCpp::Variant::Create<int>(1)),
+        };
+        auto result = setValue->get().InvokeBatch(invalid, args);
+        REQUIRE(result.has_error());
+        REQUIRE(result.error().type == ReflCpp::FunctionWrapperInvokeError::Type::ObjectIsInvalid);
+        REQUIRE(testInstance.getValue() == 9);
+
+        std::vector<int> wrongType(2);
+        REQUIRE(setValue->get().InvokeBatch(std::span(wrongType), args).has_error());
+
+        // every instance gets its own copy of an argument taken by rvalue reference
+        auto takeName = TRY_FAIL(ReflCpp::Reflect<TestClasses::ArgumentClass>()).GetMethod("takeName");
+        REQUIRE(takeName.has_value());
+        std::vector<TestClasses::ArgumentClass> receivers(4);
+        std::string batchName = "batch";
+        const ReflCpp::ArgumentPack names{ TRY_FAIL(ReflCpp::Variant::Create<std::string&&>(std::move(batchName))) };
+        REQUIRE(!takeName->get().InvokeBatch(std::span(receivers), names).has_error());
+        for (const auto& receiver : receivers) {
+            REQUIRE(receiver.name == "batch");
+        }
+        REQUIRE(batchName == "batch");
+    }
+
+    SECTION("Parallel invoke") {
+        auto setValue = testType.GetMethod("setValue");
+        REQUIRE(setValue.has_value());
+        auto getValue = testType.GetMethod("getValue");
+        REQUIRE(getValue.has_value());
+        ReflCpp::ThreadPool pool({ .threads = 3, .chunkSize = 4 });
+
+        std::vector<TestClasses::SimpleClass> instances(50);
+        const ReflCpp::ArgumentPack args{ TRY_FAIL(ReflCpp::Variant::Create<int>(11)) };
+        REQUIRE(!setValue->get().InvokeParallel(pool, std::span(instances), args).has_error());
+        for (const auto& instance : instances) {
+            REQUIRE(instance.getValue() == 11);
+        }
+
+        instances[17].setValue(2);
+        std::vector<ReflCpp::Variant> results(instances.size(), ReflCpp::Variant::Void());
+        REQUIRE(!getValue->get().InvokeParallel(pool, std::span(instances), {}, results).has_error());
+        REQUIRE(TRY_FAIL(results[16].Get<int>()) == 11);
+        REQUIRE(TRY_FAIL(results[17].Get<int>()) == 2);
+
+        // the error of the lowest index is reported, no matter which thread ran into it first
+        std::vector<int> slots(instances.size());
+        std::vector<ReflCpp::Variant> slotViews;
+        for (size_t i = 0; i < instances.size(); ++i) {
+            slotViews.push_back(i == 9 || i == 30
+                ? TRY_FAIL(ReflCpp::Variant::Create<std::string&>(testInstance.name))
+                : TRY_FAIL(ReflCpp::Variant::Create<int&>(slots[i])));
+        }
+        auto result = getValue->get().InvokeParallel(pool, std::span(instances), {}, slotViews);
+        REQUIRE(result.has_error());
+        REQUIRE(result.error().index == 9);
+        REQUIRE(result.error().error.type == ReflCpp::FunctionWrapperInvokeError::Type::IncompatibleReturnSlot);
+
+        // or every instance gets its own error
+        std::vector<std::optional<ReflCpp::FunctionWrapperInvokeError>> errors(instances.size());
+        REQUIRE(!getValue->get().InvokeParallel(pool, std::span(instances), {}, slotViews, errors).has_error());
+        for (size_t i = 0; i < instances.size(); ++i) {
+            REQUIRE(errors[i].has_value() == (i == 9 || i == 30));
+        }
+        REQUIRE(slots[49] == 11);
+
+        // objects held by variants, which are all checked before invoking
+        std::vector<ReflCpp::Variant> variants;
+        for (auto& instance : instances) {
+            variants.push_back(TRY_FAIL(ReflCpp::Variant::Create<TestClasses::SimpleClass&>(instance)));
+        }
+        const ReflCpp::ArgumentPack five{ TRY_FAIL(ReflCpp::Variant::Create<int>(5)) };
+        REQUIRE(!setValue->get().InvokeParallel(pool, variants, five).has_error());
+        REQUIRE(instances[33].getValue() == 5);
+
+        variants[20] = TRY_FAIL(ReflCpp::Variant::Create<int>(1));
+        result = setValue->get().InvokeParallel(pool, variants, args);
+        REQUIRE(result.has_error());
+        REQUIRE(result.error().index == 20);
+        REQUIRE(instances[0].getValue() == 5);
+
+        REQUIRE(!setValue->get().InvokeParallel(pool, variants, args, {}, errors).has_error());
+        REQUIRE(errors[20].has_value());
+        REQUIRE(instances[0].getValue() == 11);
+    }
+
+    SECTION("Prepared call") {
+        auto add = testType.GetMethod("add");
+        REQUIRE(add.has_value());
+
+        // resolves to the string overload once
+        const auto prepared = TRY_FAIL(add->get().Prepare<std::string, std::string>());
+        REQUIRE_FALSE(prepared.IsStatic());
+
+        ReflCpp::ArgumentList args;
+        args.push_back(TRY_FAIL(ReflCpp::Variant::Create<std::string>("a")));
+        args.push_back(TRY_FAIL(ReflCpp::Variant::Create<std::string>("b")));
+        REQUIRE(prepared.Matches(args));
+        REQUIRE(prepared.GetSignature() == ReflCpp::ArgumentSignature::Of(args));
+        const auto joined = TRY_FAIL(prepared.Invoke(instanceVariant, args));
+        REQUIRE(TRY_FAIL(joined.Get<std::string>()) == "ab");
+
+        // the object is still checked
+        REQUIRE(prepared.Invoke(args).has_error());
+
+        // references can be prepared for as well
+        const auto preparedInts = TRY_FAIL(add->get().Prepare<int&, int&>());
+        int a = 1;
+        int b = 2;
+        ReflCpp::ArgumentList intArgs;
+        intArgs.push_back(TRY_FAIL(ReflCpp::Variant::Create<int&>(a)));
+        intArgs.push_back(TRY_FAIL(ReflCpp::Variant::Create<int&>(b)));
+        REQUIRE(preparedInts.Matches(intArgs));
+        const auto ints = TRY_FAIL(preparedInts.Invoke(instanceVariant, intArgs));
+        REQUIRE(TRY_FAIL(ints.Get<int>()) == 3);
+
+        REQUIRE(add->get().Prepare<std::string, int>().has_error());
+        REQUIRE(add->get().Prepare<int>().has_error());
+    }
+
+    SECTION("Typed delegate") {
+        auto add = testType.GetMethod("add");
+        REQUIRE(add.has_value());
+
+        // member functions take their object first
+        const auto addInts = add->get().As<int(const TestClasses::SimpleClass&, int, int)>();
+        REQUIRE(addInts.has_value());
+        REQUIRE((*addInts)(testInstance, 40, 2) == 42);
+
+        const auto addStrings = add->get().As<std::string(const TestClasses::SimpleClass&, const std::string&, const std::string&)>();
+        REQUIRE(addStrings.has_value());
+        REQUIRE((*addStrings)(testInstance, "a", "b") == "ab");
+
+        // signatures have to match exactly
+        REQUIRE_FALSE(add->get().As<int(TestClasses::SimpleClass&, int, int)>().has_value());
+        REQUIRE_FALSE(add->get().As<long(const TestClasses::SimpleClass&, int, int)>().has_value());
+        REQUIRE_FALSE(add->get().As<int(int, int)>().has_value());
+
+        auto setValue = testType.GetMethod("setValue");
+        REQUIRE(setValue.has_value());
+        const auto set = setValue->get().As<void(TestClasses::SimpleClass&, int)>();
+        REQUIRE(set.has_value());
+        (*set)(testInstance, 7);
+        REQUIRE(testInstance.getValue() == 7);
+
+        auto getStaticValue = testType.GetMethod("getStaticValue");
+        REQUIRE(getStaticValue.has_value());
+        const auto getStatic = getStaticValue->get().As<int()>();
+        REQUIRE(getStatic.has_value());
+        REQUIRE((*getStatic)() == TestClasses::SimpleClass::staticValue);
+    }
+
+    SECTION("Overload resolution cache") {
+        auto add = testType.GetMethod("add");
+        REQUIRE(add.has_value());
+        const auto before = add->get().GetCacheStats();
+
+        ReflCpp::ArgumentList args;
+        args.push_back(TRY_FAIL(ReflCpp::Variant::Create<int>(1)));
+        args.push_back(TRY_FAIL(ReflCpp::Variant::Create<int>(2)));
+
+        // the first call with a shape resolves it, the following ones hit the cache
+        for (int i = 0; i < 3; ++i) {
+            const auto sum = TRY_FAIL(add->get().Invoke(instanceVariant, args));
+            REQUIRE(TRY_FAIL(sum.Get<int>()) == 3);
+        }
+
+        // a different shape resolves to a different overload
+        ReflCpp::ArgumentList stringArgs;
+        stringArgs.push_back(TRY_FAIL(ReflCpp::Variant::Create<std::string>("1")));
+        stringArgs.push_back(TRY_FAIL(ReflCpp::Variant::Create<std::string>("2")));
+        for (int i = 0; i < 3; ++i) {
+            const auto joined = TRY_FAIL(add->get().Invoke(instanceVariant, stringArgs));
+            REQUIRE(TRY_FAIL(joined.Get<std::string>()) == "12");
+        }
+
+        const auto after = add->get().GetCacheStats();
+        REQUIRE(after.hits - before.hits >= 4);
+        REQUIRE(after.misses - before.misses <= 2);
+
+        // a shape without a compatible function is never cached
+        ReflCpp::ArgumentList wrongArgs;
+        wrongArgs.push_back(TRY_FAIL(ReflCpp::Variant::Create<std::string>("1")));
+        wrongArgs.push_back(TRY_FAIL(ReflCpp::Variant::Create<int>(2)));
+        for (int i = 0; i < 2; ++i) {
+            REQUIRE(add->get().Invoke(instanceVariant, wrongArgs).has_error());
+        }
+        REQUIRE(add->get().GetCacheStats().misses - after.misses == 2);
+    }
 }
@@ -0,0 +1,236 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/schema.hpp>
+
+namespace ReflCpp::testing {
+// two versions of the same reflected types, like two programs would see them
+struct SchemaVec2 {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct SchemaVec3 {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+struct SchemaPlayerV1 {
+    uint32_t id = 0;
+    std::string name;
+    SchemaVec2 position;
+    SchemaPlayerV1* target = nullptr;
+    float score = 0.0f;
+};
+
+struct SchemaPlayerV1Copy {
+    uint32_t id = 0;
+    std::string name;
+    SchemaVec2 position;
+    SchemaPlayerV1Copy* target = nullptr;
+    float score = 0.0f;
+};
+
+struct SchemaPlayerV2 {
+    std::string name;
+    uint64_t id = 0;
+    SchemaVec3 position;
+    SchemaPlayerV2* target = nullptr;
+    uint8_t level = 0;
+};
+
+struct SchemaEntity2 : SchemaVec2 {
+    uint32_t id = 0;
+};
+
+struct SchemaEntity3 : SchemaVec3 {
+    uint32_t id = 0;
+};
+
+struct SchemaColor {
+    static const SchemaColor Red;
+
+    uint8_t r = 0;
+    uint8_t g = 0;
+    uint8_t b = 0;
+};
+
+const SchemaColor SchemaColor::Red{ 255, 0, 0 };
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaVec2){
+    .name = "Vec",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaVec2::x, .name = "x" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaVec2::y, .name = "y" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaVec3){
+    .name = "Vec",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaVec3::x, .name = "x" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaVec3::y, .name = "y" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaVec3::z, .name = "z" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaPlayerV1){
+    .name = "Player",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1::position, .name = "position" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1::target, .name = "target" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1::score, .name = "score" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaPlayerV1Copy){
+    .name = "Player",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1Copy::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1Copy::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1Copy::position, .name = "position" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1Copy::target, .name = "target" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV1Copy::score, .name = "score" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaPlayerV2){
+    .name = "Player",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV2::name, .name = "name" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV2::id, .name = "id" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV2::position, .name = "position" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV2::target, .name = "target" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaPlayerV2::level, .name = "level" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaEntity2){
+    .name = "Entity",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::SchemaVec2>().value() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaEntity2::id, .name = "id" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaEntity3){
+    .name = "Entity",
+    ._namespace = "ReflCpp::testing",
+    .bases = { ReflCpp::ReflectID<ReflCpp::testing::SchemaVec3>().value() },
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaEntity3::id, .name = "id" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::SchemaColor){
+    .name = "Color",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{ .ptr = &ReflCpp::testing::SchemaColor::Red, .name = "Red" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaColor::r, .name = "r" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaColor::g, .name = "g" },
+        FieldData{ .ptr = &ReflCpp::testing::SchemaColor::b, .name = "b" },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+#define TRY_FAIL(...) \
+    RESCPP_TRY_IMPL((__VA_ARGS__), { \
+        FAIL("result was bad\n" << std::stacktrace::current(1)); \
+    })
+
+namespace ReflCpp::testing {
+TEST_CASE("Schema Tests", "[schema]") {
+    const Type& v1 = TRY_FAIL(Reflect<SchemaPlayerV1>());
+    const Type& v1_copy = TRY_FAIL(Reflect<SchemaPlayerV1Copy>());
+    const Type& v2 = TRY_FAIL(Reflect<SchemaPlayerV2>());
+
+    SECTION("Fingerprint") {
+        REQUIRE(v1.GetFingerprint() != 0);
+        REQUIRE(v1.GetFingerprint() == v1.GetFingerprint());
+
+        // different C++ types reflected the same way, including the pointer back to themselves
+        REQUIRE(v1.GetFingerprint() == v1_copy.GetFingerprint());
+        REQUIRE(v1.GetFingerprint() != v2.GetFingerprint());
+
+        // a field type changing changes every type holding it
+        const Type& vec2 = TRY_FAIL(Reflect<SchemaVec2>());
+        const Type& vec3 = TRY_FAIL(Reflect<SchemaVec3>());
+        REQUIRE(vec2.GetNameHash() == vec3.GetNameHash());
+        REQUIRE(vec2.GetFingerprint() != vec3.GetFingerprint());
+
+        const Type& entity2 = TRY_FAIL(Reflect<SchemaEntity2>());
+        const Type& entity3 = TRY_FAIL(Reflect<SchemaEntity3>());
+        REQUIRE(entity2.GetFingerprint() != entity3.GetFingerprint());
+
+        // static fields of the own type only cover its name
+        const Type& color = TRY_FAIL(Reflect<SchemaColor>());
+        REQUIRE(color.GetFingerprint() != 0);
+        REQUIRE(TRY_FAIL(TypeSchema::Of(color)).fields.size() == 4);
+        REQUIRE(TRY_FAIL(DiffSchema(color, color)).empty());
+    }
+
+    SECTION("Diff") {
+        REQUIRE(TRY_FAIL(DiffSchema(v1, v1_copy)).empty());
+
+        using Kind = SchemaDifference::Kind;
+        const std::vector<SchemaDifference> expected{
+            { Kind::FieldType, "id" },
+            { Kind::FieldOrder, "id" },
+            { Kind::FieldOrder, "name" },
+            { Kind::FieldType, "position" },
+            { Kind::MissingField, "score" },
+            { Kind::ExtraField, "level" },
+        };
+        REQUIRE(TRY_FAIL(DiffSchema(v1, v2)) == expected);
+
+        const std::vector<SchemaDifference> bases{
+            { Kind::Base, "ReflCpp::testing::Vec" },
+        };
+        REQUIRE(TRY_FAIL(DiffSchema(TRY_FAIL(Reflect<SchemaEntity2>()), TRY_FAIL(Reflect<SchemaEntity3>()))) == bases);
+    }
+
+    SECTION("Schema") {
+        const TypeSchema schema = TRY_FAIL(TypeSchema::Of(v1));
+        REQUIRE(schema.name == "ReflCpp::testing::Player");
+        REQUIRE(schema.fingerprint == v1.GetFingerprint());
+        REQUIRE(schema.fields.size() == 5);
+        REQUIRE(schema.fields[3].name == "target");
+        REQUIRE(schema.fields[3].type == "ReflCpp::testing::Player*");
+
+        // a schema received from elsewhere compares the same way
+        TypeSchema changed = schema;
+        changed.fields[4].isConst = true;
+        REQUIRE(DiffSchema(schema, changed) == std::vector<SchemaDifference>{ { SchemaDifference::Kind::FieldQualifiers, "score" } });
+    }
+}
+}
@@ -0,0 +1,193 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/soa.hpp>
+
+namespace ReflCpp::testing {
+struct Position {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+struct Sample {
+    double time = 0.0;
+    uint8_t channel = 0;
+    float value = 0.0f;
+    const int16_t version = 2;
+    Position position;
+};
+
+struct NamedSample {
+    int id = 0;
+    std::string name;
+};
+
+struct VirtualSample {
+    virtual ~VirtualSample() = default;
+
+    int id = 0;
+};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::Position){
+    .name = "Position",
+    ._namespace = "ReflCpp::testing",
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::Sample){
+    .name = "Sample",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{
+            .ptr = &ReflCpp::testing::Sample::time,
+            .name = "time",
+        },
+        FieldData{
+            .ptr = &ReflCpp::testing::Sample::channel,
+            .name = "channel",
+        },
+        FieldData{
+            .ptr = &ReflCpp::testing::Sample::value,
+            .name = "value",
+        },
+        FieldData{
+            .ptr = &ReflCpp::testing::Sample::version,
+            .name = "version",
+        },
+        FieldData{
+            .ptr = &ReflCpp::testing::Sample::position,
+            .name = "position",
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::NamedSample){
+    .name = "NamedSample",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{
+            .ptr = &ReflCpp::testing::NamedSample::id,
+            .name = "id",
+        },
+        FieldData{
+            .ptr = &ReflCpp::testing::NamedSample::name,
+            .name = "name",
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA(ReflCpp::testing::VirtualSample){
+    .name = "VirtualSample",
+    ._namespace = "ReflCpp::testing",
+    .fields = {
+        FieldData{
+            .ptr = &ReflCpp::testing::VirtualSample::id,
+            .name = "id",
+        },
+    },
+}
+REFLCPP_REFLECT_DATA_END()
+
+#define TRY_FAIL(...) \
+    RESCPP_TRY_IMPL((__VA_ARGS__), { \
+        FAIL("result was bad\n" << std::stacktrace::current(1)); \
+    })
+
+namespace ReflCpp::testing {
+TEST_CASE("StructOfArrays Tests", "[soa]") {
+    std::vector<Sample> samples(100);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i].time = static_cast<double>(i) * 0.5;
+        samples[i].channel = static_cast<uint8_t>(i % 4);
+        samples[i].value = static_cast<float>(i);
+        samples[i].position.y = static_cast<float>(i) + 0.25f;
+    }
+
+    SECTION("Plan") {
+        const SoAPlan& plan = TRY_FAIL(detail::GetSoAPlan<Sample>());
+        REQUIRE(&plan == &TRY_FAIL(detail::GetSoAPlan<Sample>()));
+        REQUIRE(plan.type == TRY_FAIL(ReflectID<Sample>()));
+        REQUIRE(plan.stride == sizeof(Sample));
+        REQUIRE(plan.columns.size() == 5);
+        REQUIRE(plan.columns[2].offset == offsetof(Sample, value));
+        REQUIRE(plan.columns[4].size == sizeof(Position));
+        REQUIRE(plan.FindColumn("channel") == 1);
+        REQUIRE_FALSE(plan.FindColumn("missing").has_value());
+    }
+
+    SECTION("Columns") {
+        const auto soa = TRY_FAIL(ToSoA(samples));
+        REQUIRE(soa.Size() == samples.size());
+
+        const auto times = soa.Column<double>("time");
+        REQUIRE(times.has_value());
+        REQUIRE(times->size() == samples.size());
+        REQUIRE((*times)[10] == 5.0);
+        REQUIRE(reinterpret_cast<uintptr_t>(times->data()) % 64 == 0);
+
+        REQUIRE(soa.Column<uint8_t>("channel")->back() == 3);
+        REQUIRE(soa.Column<int16_t>("version")->front() == 2);
+        REQUIRE(soa.RawColumn(4).size() == sizeof(Position) * samples.size());
+        REQUIRE(soa.Column<Position>("position")->back().y == 99.25f);
+
+        REQUIRE_FALSE(soa.Column<float>("time").has_value());
+        REQUIRE_FALSE(soa.Column<float>("missing").has_value());
+    }
+
+    SECTION("Round trip") {
+        auto soa = TRY_FAIL(ToSoA(samples));
+        const auto values = soa.Column<float>("value");
+        REQUIRE(values.has_value());
+        for (float& value : *values) {
+            value *= 2.0f;
+        }
+
+        const std::vector<Sample> restored = soa.ToVector();
+        REQUIRE(restored.size() == samples.size());
+        REQUIRE(restored[7].value == 14.0f);
+        REQUIRE(restored[7].time == samples[7].time);
+        REQUIRE(restored[7].position.y == samples[7].position.y);
+
+        REQUIRE(soa.CopyTo(samples));
+        REQUIRE(samples[99].value == 198.0f);
+        REQUIRE_FALSE(soa.CopyTo(std::span(samples).first(10)));
+    }
+
+    SECTION("Fields without byte copies") {
+        // strings are not trivially copyable, so they stay out of the plan
+        const std::vector<NamedSample> named{ { 1, "one" }, { 2, "two" } };
+        const auto soa = TRY_FAIL(ToSoA(named));
+        REQUIRE(soa.GetPlan().columns.size() == 1);
+        REQUIRE(soa.Column<int>("id")->back() == 2);
+        REQUIRE_FALSE(soa.Column<std::string>("name").has_value());
+
+        const std::vector<NamedSample> restored = soa.ToVector();
+        REQUIRE(restored[1].id == 2);
+        REQUIRE(restored[1].name.empty());
+    }
+
+    SECTION("Unsupported") {
+        // field offsets are only known for standard layout types
+        REQUIRE(detail::GetSoAPlan<VirtualSample>().error() == SoAError::Unsupported);
+        REQUIRE(ToSoA(std::vector<VirtualSample>(2)).error() == SoAError::Unsupported);
+    }
+
+    SECTION("Empty") {
+        const auto soa = TRY_FAIL(ToSoA(std::vector<Sample>{}));
+        REQUIRE(soa.Size() == 0);
+        REQUIRE(soa.Column<double>("time")->empty());
+    }
+}
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <refl-cpp/refl-cpp.hpp>
+#include <refl-cpp/thread_pool.hpp>
+
+namespace ReflCpp::testing {
+TEST_CASE("ThreadPool Tests", "[thread_pool]") {
+    SECTION("Every index once") {
+        ThreadPool pool({ .threads = 4, .chunkSize = 7 });
+        REQUIRE(pool.GetThreadCount() == 4);
+        REQUIRE(pool.GetChunkSize() == 7);
+
+        // assertions are not thread safe, so everything is checked afterwards
+        std::vector<std::atomic<int>> visits(1000);
+        std::atomic<bool> chunksAligned = true;
+        pool.ParallelFor(visits.size(), [&](const size_t begin, const size_t end) {
+            if (begin % 7 != 0 || end - begin > 7) {
+                chunksAligned = false;
+            }
+            for (size_t i = begin; i < end; ++i) {
+                visits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        REQUIRE(chunksAligned.load());
+        for (const auto& visit : visits) {
+            REQUIRE(visit.load() == 1);
+        }
+    }
+
+    SECTION("Uneven work") {
+        ThreadPool pool({ .threads = 4, .chunkSize = 1 });
+
+        // the chunks of the calling thread are slow, so the others steal them once done with their own
+        std::vector<std::atomic<bool>> ran(64);
+        pool.ParallelFor(ran.size(), [&](const size_t begin, const size_t) {
+            if (begin < ran.size() / 4) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            ran[begin] = true;
+        });
+
+        for (const auto& chunk : ran) {
+            REQUIRE(chunk.load());
+        }
+    }
+
+    SECTION("Jobs one after another") {
+        ThreadPool pool({ .threads = 3, .chunkSize = 16 });
+        std::atomic<size_t> sum = 0;
+        for (size_t job = 0; job < 50; ++job) {
+            pool.ParallelFor(100, [&](const size_t begin, const size_t end) {
+                sum.fetch_add(end - begin, std::memory_order_relaxed);
+            });
+        }
+        REQUIRE(sum.load() == 5000);
+
+        bool called = false;
+        pool.ParallelFor(0, [&](size_t, size_t) {
+            called = true;
+        });
+        REQUIRE_FALSE(called);
+    }
+
+    SECTION("Single thread") {
+        ThreadPool pool({ .threads = 1, .chunkSize = 10 });
+        size_t calls = 0;
+        pool.ParallelFor(95, [&](const size_t, const size_t) {
+            ++calls;
+        });
+        REQUIRE(calls == 10);
+    }
+
+    SECTION("Exceptions") {
+        ThreadPool pool({ .threads = 4, .chunkSize = 1 });
+        std::atomic<size_t> ran = 0;
+        REQUIRE_THROWS_AS(pool.ParallelFor(100, [&](const size_t begin, const size_t) {
+            ran.fetch_add(1, std::memory_order_relaxed);
+            if (begin == 42) {
+                throw std::runtime_error("chunk failed");
+            }
+        }), std::runtime_error);
+        REQUIRE(ran.load() <= 100);
+
+        // the pool is still usable afterwards
+        std::atomic<size_t> sum = 0;
+        pool.ParallelFor(100, [&](const size_t begin, const size_t end) {
+            sum.fetch_add(end - begin, std::memory_order_relaxed);
+        });
+        REQUIRE(sum.load() == 100);
+    }
+
+    SECTION("Chunk count limit") {
+        ThreadPool pool({ .threads = 2, .chunkSize = 1 });
+        REQUIRE(pool.GetChunkSize(1000) == 1);
+        REQUIRE(pool.GetChunkSize(ThreadPool::MaxChunks) == 1);
+
+        // more chunks than the queues can count get merged into larger ones
+        constexpr size_t count = size_t(1) << 40;
+        const size_t chunkSize = pool.GetChunkSize(count);
+        REQUIRE(chunkSize == 257);
+        REQUIRE((count + chunkSize - 1) / chunkSize <= ThreadPool::MaxChunks);
+    }
+}
+}
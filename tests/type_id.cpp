@@ -0,0 +1,86 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <refl-cpp/refl-cpp.hpp>
+
+namespace ReflCpp::testing {
+struct TypeIDTestStruct {};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(ReflCpp::testing::TypeIDTestStruct)
+REFLCPP_REFLECT_DATA_DEF(ReflCpp::testing::TypeIDTestStruct)
+{ .name = "TypeIDTestStruct" }
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace {
+// 'database.cpp' reflects a struct with the same name, so the names of both hash the same
+struct CollidingStruct {};
+}
+
+REFLCPP_REFLECT_TEMPLATE()
+REFLCPP_REFLECT_DATA_DECL(CollidingStruct)
+REFLCPP_REFLECT_DATA_DEF(CollidingStruct)
+{ .name = "CollidingStruct" }
+REFLCPP_REFLECT_DATA_DEF_END()
+
+namespace ReflCpp::testing {
+/// Registers the 'CollidingStruct' of 'database.cpp'.
+rescpp::result<TypeID, ReflectError> ReflectOtherCollidingStruct() noexcept;
+
+TEST_CASE("TypeID Tests", "[type_id]") {
+    SECTION("TypeName") {
+        STATIC_CHECK(detail::TypeName<int>() == "int");
+        STATIC_CHECK(detail::TypeName<TypeIDTestStruct>().ends_with("ReflCpp::testing::TypeIDTestStruct"));
+    }
+
+    SECTION("StableTypeID") {
+        STATIC_CHECK(StableTypeID<int>().IsValid());
+        STATIC_CHECK(StableTypeID<int>() == StableTypeID<int>());
+        STATIC_CHECK(StableTypeID<int>() != StableTypeID<const int>());
+        STATIC_CHECK(StableTypeID<void>().IsInvalid());
+
+        // keywords some compilers put in front of class names are ignored
+        STATIC_CHECK(detail::HashTypeName("struct Foo::Bar") == detail::HashTypeName("Foo::Bar"));
+        STATIC_CHECK(detail::HashTypeName("Foo<class Bar>") == detail::HashTypeName("Foo<Bar>"));
+        STATIC_CHECK(detail::HashTypeName("Foo<Bar, Baz>") == detail::HashTypeName("Foo<Bar,Baz>"));
+        STATIC_CHECK(detail::HashTypeName("my_struct Foo") != detail::HashTypeName("Foo"));
+
+        // usable as switch label
+        switch (StableTypeID<float>()) {
+            case StableTypeID<float>():
+                SUCCEED();
+                break;
+            default:
+                FAIL("StableTypeID<float>() did not match itself");
+        }
+    }
+
+    SECTION("Registered ID") {
+        const TypeID id = ReflectID<TypeIDTestStruct>().value();
+        CHECK(detail::TypeIDCache<TypeIDTestStruct>::Load() == id);
+        CHECK(id.Equals<TypeIDTestStruct>());
+        CHECK(id.EqualsCached<TypeIDTestStruct>());
+        CHECK_FALSE(id.Equals<int>());
+
+#ifdef REFLCPP_STABLE_TYPE_IDS
+        CHECK(id == StableTypeID<TypeIDTestStruct>());
+        CHECK(ReflectionDatabase::Instance().GetType(StableTypeID<TypeIDTestStruct>()).value().Is<TypeIDTestStruct>());
+#endif
+    }
+
+    SECTION("Collision") {
+        const TypeID id = ReflectID<CollidingStruct>().value();
+        const auto other = ReflectOtherCollidingStruct();
+
+#ifdef REFLCPP_STABLE_TYPE_IDS
+        // the type registered second is refused instead of replacing the first one
+        REQUIRE(other.has_error());
+        CHECK(other.error() == ReflectError::IDCollision);
+        CHECK(ReflectionDatabase::Instance().GetType(id).value().Is<CollidingStruct>());
+#else
+        REQUIRE(other.has_value());
+        CHECK(other.value() != id);
+#endif
+    }
+}
+}
@@ -6,6 +6,8 @@ namespace ReflCpp {
 struct TestStruct {
     int value = 42;
 };
+
+struct UnreflectedStruct {};
 }
 
 REFLCPP_REFLECT_TEMPLATE()
@@ -115,6 +117,22 @@ TEST_CASE("Variant Tests", "[variant]") {
         CHECK(v2.Get<const int&&>().value() == 42);
     }
 
+    SECTION("Temporary") {
+        const auto variant = Variant::Create<int>(42).value();
+        const auto temporary = Variant::CreateTemporary<int>(42).value();
+
+        CHECK(VariantTestHelper::IsInline(temporary));
+        CHECK(VariantTestHelper::UsesWrapper(temporary, detail::VariantWrapperType::RVALUE_REF));
+        CHECK(temporary.CanGet<int>());
+        CHECK(temporary.CanGet<const int&>());
+        CHECK(temporary.CanGet<int&&>());
+        CHECK_FALSE(temporary.CanGet<int&>());
+        CHECK(temporary.Get<int&&>().value() == 42);
+
+        // unlike a value, which can be written to
+        CHECK(variant.CanGet<int&>());
+    }
+
     SECTION("ConstRValueReference") {
         int value = 42;
         const auto variant = Variant::Create<const int&&>(std::move(value)).value();
@@ -176,6 +194,72 @@ TEST_CASE("Variant Tests", "[variant]") {
         CHECK(variant.Get<TestStruct>().value().value == 100);
     }
 
+    SECTION("InlineStorage") {
+        int value = 42;
+        TestStruct obj;
+
+        CHECK(VariantTestHelper::IsInline(Variant::Void()));
+        CHECK(VariantTestHelper::IsInline(Variant::Create<int>(value).value()));
+        CHECK(VariantTestHelper::IsInline(Variant::Create<int&>(value).value()));
+        CHECK(VariantTestHelper::IsInline(Variant::Create<const int*>(&value).value()));
+        CHECK(VariantTestHelper::IsInline(Variant::Create<TestStruct>(obj).value()));
+        CHECK_FALSE(VariantTestHelper::IsInline(Variant::Create<std::string>("not trivially copyable").value()));
+
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Void(), detail::VariantWrapperType::VOID));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<int>(value).value(), detail::VariantWrapperType::VALUE));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<const int&>(value).value(), detail::VariantWrapperType::CONST_LVALUE_REF));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<int*>(&value).value(), detail::VariantWrapperType::POINTER));
+
+        // copies of inline values are independent of each other
+        const auto v1 = Variant::Create<int>(value).value();
+        const auto v2 = v1;
+        v2.Get<int&>().value() = 100;
+        CHECK(v1.Get<int>().value() == 42);
+        CHECK(v2.Get<int>().value() == 100);
+        CHECK_FALSE(v1.IsShared());
+
+        // while copies of heap values share them
+        const auto h1 = Variant::Create<std::string>("shared").value();
+        CHECK_FALSE(h1.IsShared());
+        const auto h2 = h1;
+        CHECK(h1.IsShared());
+        CHECK(h2.GetAddress() == h1.GetAddress());
+
+        // copies of references still refer to the same object
+        const auto r1 = Variant::Create<int&>(value).value();
+        const auto r2 = r1;
+        r2.Get<int&>().value() = 100;
+        CHECK(value == 100);
+        CHECK(r1.Get<int>().value() == 100);
+    }
+
+    SECTION("WrapperTypeOf") {
+        int value = 42;
+        const int constValue = 42;
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<int>(value).value(), detail::VariantWrapperTypeOf<int>()));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<const int>(constValue).value(), detail::VariantWrapperTypeOf<const int>()));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<int&>(value).value(), detail::VariantWrapperTypeOf<int&>()));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<const int&>(value).value(), detail::VariantWrapperTypeOf<const int&>()));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<int&&>(std::move(value)).value(), detail::VariantWrapperTypeOf<int&&>()));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<int*>(&value).value(), detail::VariantWrapperTypeOf<int*>()));
+        CHECK(VariantTestHelper::UsesWrapper(Variant::Create<const int*>(&value).value(), detail::VariantWrapperTypeOf<const int*>()));
+    }
+
+    SECTION("GetUnchecked") {
+        int value = 42;
+        const auto ref = Variant::Create<int&>(value).value();
+        const auto ptr = Variant::Create<int*>(&value).value();
+        const auto copy = Variant::Create<int>(value).value();
+
+        CHECK(&ref.GetUnchecked<int&>() == &value);
+        CHECK(&ref.GetUnchecked<const int&>() == &value);
+        CHECK(ptr.GetUnchecked<const int*>() == &value);
+        CHECK(&copy.GetUnchecked<int&>() == &copy.Get<int&>().value());
+
+        ref.GetUnchecked<int&>() = 100;
+        CHECK(value == 100);
+    }
+
     SECTION("TypeMismatch") {
         int value = 42;
         const auto variant = Variant::Create<int>(value).value();
@@ -185,6 +269,10 @@ TEST_CASE("Variant Tests", "[variant]") {
         CHECK_FALSE(variant.CanGet<std::string>());
         CHECK_FALSE(variant.CanGet<TestStruct>());
 
+        // matching never needs to register the requested type
+        CHECK_FALSE(variant.CanGet<UnreflectedStruct>());
+        CHECK_FALSE(variant.CanGet<const UnreflectedStruct&>());
+
         // Test actual Get with wrong types
         CHECK(variant.Get<double>().has_error());
         CHECK(variant.Get<std::string>().has_error());